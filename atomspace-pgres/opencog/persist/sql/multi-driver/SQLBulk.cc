@@ -156,6 +156,9 @@ void SQLAtomStorage::loadAtomSpace(AtomSpace* table)
 
 	setup_typemap();
 
+	// Avoid rehashing the TLB while the parallel loaders run.
+	_tlbuf.reserve(max_nrec);
+
 #define NCHUNKS 300
 #define MINSTEP 10123
 	std::vector<unsigned long> steps;
@@ -0,0 +1,176 @@
+//
+// benchmark/rocks_bench.cc
+//
+// Cost of the paths that every Atom and Value takes on its way to and
+// from RocksDB: the s-expression encoding and decoding that is used
+// for the keys and the stored values, and then the store, fetch and
+// bulk load of whole AtomSpaces.
+//
+// Usage: rocks_bench [number-of-atoms] [repetitions] [uri]
+//
+// The database at `uri` (by default, rocks:///tmp/cog-rocks-bench)
+// is erased, both before and after the run.
+//
+// See <opencog/benchmark/bench.h> for the report format.
+
+#include <string>
+
+#include <opencog/atoms/base/Link.h>
+#include <opencog/atoms/base/Node.h>
+#include <opencog/atoms/value/FloatValue.h>
+#include <opencog/atomspace/AtomSpace.h>
+#include <opencog/benchmark/bench.h>
+#include <opencog/persist/rocks/RocksStorage.h>
+#include <opencog/persist/sexpr/Sexpr.h>
+
+using namespace opencog;
+using bench::run;
+using bench::sink;
+
+int main(int argc, char* argv[])
+{
+	bench::init(argc, argv, 20000);
+	size_t natoms = bench::size;
+	std::string uri = 3 < argc ? argv[3] : "rocks:///tmp/cog-rocks-bench";
+
+	// Each node is in two ListLinks and one EvaluationLink, and has
+	// a FloatValue on it.
+	AtomSpacePtr as = createAtomSpace();
+	Handle pred = as->add_node(PREDICATE_NODE, "pred");
+	Handle key = as->add_node(PREDICATE_NODE, "key");
+	HandleSeq nodes, links;
+	for (size_t i = 0; i < natoms; i++)
+		nodes.push_back(as->add_node(CONCEPT_NODE,
+			"node " + std::to_string(i)));
+	for (size_t i = 0; i < natoms; i++)
+	{
+		links.push_back(as->add_link(EVALUATION_LINK, {pred,
+			as->add_link(LIST_LINK, {nodes[i], nodes[(i+1) % natoms]})}));
+		as->set_value(nodes[i], key, createFloatValue(
+			std::vector<double>({(double) i, 0.5 * i, 1.0})));
+	}
+
+	// ------------------------------------------------------------
+	// S-expressions.
+
+	std::vector<std::string> snodes, slinks, svalues;
+	run("sexpr/encode_node", natoms, [&]() {
+		snodes.clear();
+		for (const Handle& h : nodes)
+			snodes.push_back(Sexpr::encode_atom(h));
+	});
+
+	run("sexpr/encode_link", natoms, [&]() {
+		slinks.clear();
+		for (const Handle& h : links)
+			slinks.push_back(Sexpr::encode_atom(h));
+	});
+
+	run("sexpr/encode_value", natoms, [&]() {
+		svalues.clear();
+		for (const Handle& h : nodes)
+			svalues.push_back(Sexpr::encode_value(h->getValue(key)));
+	});
+
+	run("sexpr/encode_atom_values", natoms, [&]() {
+		for (const Handle& h : nodes)
+			sink += Sexpr::encode_atom_values(h).size();
+	});
+
+	run("sexpr/decode_node", natoms, [&]() {
+		for (const std::string& s : snodes)
+			sink += (bool) Sexpr::decode_atom(s);
+	});
+
+	run("sexpr/decode_link", natoms, [&]() {
+		for (const std::string& s : slinks)
+			sink += (bool) Sexpr::decode_atom(s);
+	});
+
+	run("sexpr/decode_value", natoms, [&]() {
+		for (const std::string& s : svalues)
+		{
+			size_t pos = 0;
+			sink += (bool) Sexpr::decode_value(s, pos);
+		}
+	});
+
+	// ------------------------------------------------------------
+	// RocksDB. The store cases include the barrier, so that what is
+	// measured is the time to get the Atoms onto disk.
+
+	RocksStorage store(uri);
+	store.open();
+	if (not store.connected())
+	{
+		fprintf(stderr, "Cannot open %s\n", uri.c_str());
+		return 1;
+	}
+
+	run("rocks/storeAtom", natoms,
+		[&]() { store.kill_data(); },
+		[&]() {
+			for (const Handle& h : links)
+				store.storeAtom(h);
+			store.barrier();
+		});
+
+	run("rocks/storeValue", natoms, [&]() {
+		for (const Handle& h : nodes)
+			store.storeValue(h, key);
+		store.barrier();
+	});
+
+	// Fetch the Value on each node, onto a fresh, naked copy of it.
+	// A copy that comes back without the Value was not found.
+	HandleSeq naked;
+	size_t missing = 0;
+	run("rocks/getAtom", natoms,
+		[&]() {
+			naked.clear();
+			for (const Handle& h : nodes)
+				naked.push_back(createNode(CONCEPT_NODE,
+					std::string(h->get_name())));
+		},
+		[&]() {
+			for (const Handle& h : naked)
+			{
+				store.getAtom(h);
+				if (nullptr == h->getValue(key)) missing++;
+			}
+		});
+
+	// Each node has two ListLinks in its incoming set.
+	HandleSeq anodes;
+	run("rocks/fetchIncomingSet", natoms,
+		[&]() {
+			as = createAtomSpace();
+			anodes.clear();
+			for (const Handle& h : nodes)
+				anodes.push_back(as->add_atom(h));
+		},
+		[&]() {
+			for (const Handle& h : anodes)
+				store.fetchIncomingSet(as.get(), h);
+			store.barrier();
+		});
+	if (as->get_num_atoms_of_type(LIST_LINK) != natoms) missing++;
+
+	// The whole database; the time reported is per Atom, and there
+	// are 3 Atoms per node.
+	run("rocks/loadAtomSpace", 3 * natoms,
+		[&]() { as = createAtomSpace(); },
+		[&]() {
+			store.loadAtomSpace(as.get());
+			store.barrier();
+		});
+	if (as->get_size() != 3 * natoms + 2) missing++;
+
+	store.kill_data();
+	if (0 < missing)
+	{
+		fprintf(stderr, "Some Atoms were not found in %s\n", uri.c_str());
+		return 1;
+	}
+	return 0;
+}
@@ -90,6 +90,13 @@ void RocksStorage::deleteFrame(AtomSpace* frame)
 			_rfile->Delete(rocksdb::WriteOptions(), kt->key());
 		delete kt;
 
+		// ... and any time-series chunks.
+		pfx[0] = 't';
+		kt = _rfile->NewIterator(rocksdb::ReadOptions());
+		for (kt->Seek(pfx); kt->Valid() and kt->key().starts_with(pfx); kt->Next())
+			_rfile->Delete(rocksdb::WriteOptions(), kt->key());
+		delete kt;
+
 		// Delete the key itself
 		_rfile->Delete(rocksdb::WriteOptions(), it->key());
 	}
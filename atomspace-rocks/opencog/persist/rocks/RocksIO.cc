@@ -23,6 +23,9 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
  */
 
+#include <random>
+#include <string.h>
+
 #include <opencog/atoms/base/Atom.h>
 #include <opencog/atoms/base/Node.h>
 #include <opencog/atoms/base/Link.h>
@@ -94,6 +97,7 @@ uint64_t RocksStorage::strtoaid(const std::string& sid) const
 // "l@" satom . sid -- finds the sid associated with the Link
 // "n@" satom . sid -- finds the sid associated with the Node
 // "k@" sid:kid . sval -- find the Atomese Value for the Atom,Key
+// "t@" sid:kid:seq . chunk -- time-series samples, starting at seq
 // "i@" sid:stype-sid . (null) -- finds IncomingSet of sid
 // "h@" shash . sid-list -- finds all sids having a given hash
 //
@@ -103,6 +107,7 @@ uint64_t RocksStorage::strtoaid(const std::string& sid) const
 // "k@" sid:fid:kid . sval -- find the Value for the Atom,AtomSpace,Key
 //                            Absent Atoms have a kid = -
 //                            Keyless Atoms have a kid = +
+// "t@" sid:fid:kid:seq . chunk -- time-series samples in a frame
 // "o@" fid:sid . (null) -- find Atoms in a given frame
 // "z" N@sid . (null) -- record height N of Link at sid
 //
@@ -129,6 +134,17 @@ uint64_t RocksStorage::strtoaid(const std::string& sid) const
 // next to each-other, in order, under the prefix `k@sid:`. If only
 // one value is needed, it can be found at `k@sid:key`.
 //
+// Time series (FloatSeriesValue) are the exception: these grow by
+// appending, and rewriting the entire series on every store would be
+// wasteful. For these, the `k@` record holds only a header (capacity
+// and sample count), while the samples themselves are stored as chunks
+// under `t@`, one chunk per store, keyed by the sequence number of the
+// first sample in it. Chunks that have fallen out of the ring buffer
+// are deleted as new ones are written. The header also carries an
+// epoch, so that a different series stored at the same key is never
+// appended onto the chunks of the old one; it is rewritten instead.
+// Storing a non-series Value at the key deletes the chunks.
+//
 // The same trick is applied for incoming-sets. So, the entire
 // incoming set for an atom appears under the prefix `i@sid:` and
 // the incoming set of a given type is under `i@sid:stype`.  There
@@ -420,10 +436,176 @@ void RocksStorage::storeMissingAtom(AtomSpace* as, const Handle& h)
 void RocksStorage::storeValue(const std::string& skid,
                               const ValuePtr& vp)
 {
+	if (vp and vp->is_type(FLOAT_SERIES_VALUE))
+	{
+		storeSeries(skid, FloatSeriesValueCast(vp));
+		return;
+	}
+
+	// If a series used to live here, its chunks must go too.
+	if (_have_series) dropSeries(skid);
+
 	std::string sval = Sexpr::encode_value(vp);
 	_rfile->Put(rocksdb::WriteOptions(), skid, sval);
 }
 
+/// Encode a time-series sequence number so that chunks sort in order.
+static std::string seqtostr(uint64_t seq)
+{
+	char buf[20];
+	snprintf(buf, sizeof(buf), "%016lx", (unsigned long) seq);
+	return buf;
+}
+
+static uint64_t read_epoch(const std::string& sval, size_t pos)
+{
+	if (sval.size() <= pos) return 0;
+	return strtoul(sval.c_str() + pos, nullptr, 16);
+}
+
+/// The series header is the s-expression for a series holding just
+/// the capacity and total, followed by the epoch, in hex. Headers
+/// without an epoch get epoch zero, which never matches.
+static FloatSeriesValuePtr decode_header(const std::string& sval,
+                                         uint64_t& epoch)
+{
+	size_t pos = 0;
+	FloatSeriesValuePtr hdr(FloatSeriesValueCast(
+		Sexpr::decode_value(sval, pos)));
+	epoch = hdr ? read_epoch(sval, pos) : 0;
+	return hdr;
+}
+
+/// A new epoch, for a series written from scratch.
+static uint64_t new_epoch(void)
+{
+	static std::mutex mtx;
+	static std::mt19937_64 gen(std::random_device{}());
+	std::lock_guard<std::mutex> lck(mtx);
+	uint64_t epoch;
+	do { epoch = gen(); } while (0 == epoch);
+	return epoch;
+}
+
+/// Remember that `fsv` is the series stored at `skid`, under `epoch`.
+void RocksStorage::tagSeries(const std::string& skid,
+                             const FloatSeriesValuePtr& fsv,
+                             uint64_t epoch)
+{
+	std::lock_guard<std::mutex> lck(_mtx_series);
+	_series[skid] = {fsv, epoch};
+
+	// Forget the series that no longer exist. Do this only now and
+	// then, as the table grows.
+	if (_series.size() < _series_sweep) return;
+	for (auto it = _series.begin(); it != _series.end(); )
+	{
+		if (it->second.fsv.expired()) it = _series.erase(it);
+		else it++;
+	}
+	_series_sweep = 2 * _series.size() + 64;
+}
+
+/// True if `fsv` is the series last stored or loaded at `skid`, and
+/// the chunks on disk were written under `epoch`.
+bool RocksStorage::isTagged(const std::string& skid,
+                            const FloatSeriesValuePtr& fsv,
+                            uint64_t epoch)
+{
+	std::lock_guard<std::mutex> lck(_mtx_series);
+	auto tag = _series.find(skid);
+	if (_series.end() == tag) return false;
+	return tag->second.epoch == epoch and tag->second.fsv.lock() == fsv;
+}
+
+/// Delete the time-series chunks, if any, stored at `skid`.
+void RocksStorage::dropSeries(const std::string& skid)
+{
+	{
+		std::lock_guard<std::mutex> lck(_mtx_series);
+		_series.erase(skid);
+	}
+
+	std::string tid = "t@" + skid.substr(2) + ":";
+	auto it = _rfile->NewIterator(rocksdb::ReadOptions());
+	for (it->Seek(tid); it->Valid() and it->key().starts_with(tid); it->Next())
+		_rfile->Delete(rocksdb::WriteOptions(), it->key());
+	delete it;
+}
+
+/// Store a time series as a header plus appended chunks. Only those
+/// samples appended since the last store are written; chunks that
+/// have dropped out of the ring buffer are deleted.
+///
+/// Appending is safe only if the chunks on disk came from this very
+/// series. If some other series was stored here (even one with the
+/// same capacity and more samples), or if the chunks were written
+/// under another epoch, the whole series is written from scratch.
+void RocksStorage::storeSeries(const std::string& skid,
+                               const FloatSeriesValuePtr& fsv)
+{
+	std::string tid = "t@" + skid.substr(2) + ":";
+	size_t cap = fsv->capacity();
+	_have_series = true;
+
+	// How much of the series is already on disk?
+	uint64_t stored = 0;
+	uint64_t epoch = 0;
+	bool fresh = true;
+	std::string sval;
+	rocksdb::Status s = _rfile->Get(rocksdb::ReadOptions(), skid, &sval);
+	if (s.ok())
+	{
+		FloatSeriesValuePtr ofs(decode_header(sval, epoch));
+		if (ofs and ofs->capacity() == cap and
+		    ofs->total() <= fsv->total() and
+		    isTagged(skid, fsv, epoch))
+		{
+			stored = ofs->total();
+			fresh = false;
+		}
+	}
+
+	if (fresh)
+	{
+		dropSeries(skid);
+		epoch = new_epoch();
+	}
+
+	// Write the new samples as one chunk, then the header.
+	uint64_t first;
+	std::vector<double> pairs(fsv->since(stored, first));
+	uint64_t total = first + pairs.size() / 2;
+	if (0 < pairs.size())
+		_rfile->Put(rocksdb::WriteOptions(), tid + seqtostr(first),
+			rocksdb::Slice((const char*) pairs.data(),
+			               pairs.size() * sizeof(double)));
+
+	std::vector<double> hdr({(double) cap, (double) total});
+	_rfile->Put(rocksdb::WriteOptions(), skid,
+		Sexpr::encode_value(createFloatSeriesValue(hdr)) +
+		" " + seqtostr(epoch));
+	tagSeries(skid, fsv, epoch);
+
+	// Delete chunks that lie entirely before the start of the buffer.
+	// They are in sequence order, so stop at the first live one.
+	if (not fresh and cap < total)
+	{
+		uint64_t oldest = total - cap;
+		size_t seqoff = tid.size();
+		auto it = _rfile->NewIterator(rocksdb::ReadOptions());
+		for (it->Seek(tid); it->Valid() and it->key().starts_with(tid); it->Next())
+		{
+			uint64_t start = strtoul(
+				it->key().ToString().substr(seqoff).c_str(), nullptr, 16);
+			uint64_t nsamp = it->value().size() / (2 * sizeof(double));
+			if (oldest < start + nsamp) break;
+			_rfile->Delete(rocksdb::WriteOptions(), it->key());
+		}
+		delete it;
+	}
+}
+
 /// Backing-store API.
 void RocksStorage::storeValue(const Handle& h, const Handle& key)
 {
@@ -497,8 +679,50 @@ ValuePtr RocksStorage::getValue(const std::string& skid)
 	if (not s.ok())
 		throw IOException(TRACE_INFO, "Internal Error!");
 
+	return getSeries(skid, sval);
+}
+
+/// Decode the Value stored at `skid`. If it is a time-series header,
+/// read in the chunks stored for it, and return the complete series.
+ValuePtr RocksStorage::getSeries(const std::string& skid,
+                                 const std::string& sval)
+{
 	size_t pos = 0;
-	return Sexpr::decode_value(sval, pos);
+	ValuePtr vp = Sexpr::decode_value(sval, pos);
+	if (nullptr == vp or not vp->is_type(FLOAT_SERIES_VALUE))
+		return vp;
+
+	FloatSeriesValuePtr hdr(FloatSeriesValueCast(vp));
+	uint64_t epoch = read_epoch(sval, pos);
+	std::vector<double> series({(double) hdr->capacity(), 0.0});
+	uint64_t total = hdr->total();
+
+	std::string tid = "t@" + skid.substr(2) + ":";
+	size_t seqoff = tid.size();
+	auto it = _rfile->NewIterator(rocksdb::ReadOptions());
+	for (it->Seek(tid); it->Valid() and it->key().starts_with(tid); it->Next())
+	{
+		// Rocks does not promise alignment; copy, don't cast.
+		const rocksdb::Slice& chunk = it->value();
+		size_t len = chunk.size() / sizeof(double);
+		size_t off = series.size();
+		series.resize(off + len);
+		memcpy(&series[off], chunk.data(), len * sizeof(double));
+
+		// A crash between writing a chunk and its header leaves
+		// the header behind; trust the chunks in that case.
+		uint64_t start = strtoul(
+			it->key().ToString().substr(seqoff).c_str(), nullptr, 16);
+		total = std::max<uint64_t>(total, start + len / 2);
+	}
+	delete it;
+
+	series[1] = (double) std::max<uint64_t>(total, (series.size() - 2) / 2);
+	FloatSeriesValuePtr fsv(createFloatSeriesValue(series));
+
+	// Later stores of this series can append to what is on disk.
+	tagSeries(skid, fsv, epoch);
+	return fsv;
 }
 
 /// Backend callback
@@ -581,8 +805,7 @@ void RocksStorage::getKeysMonospace(AtomSpace* as,
 			continue;
 		}
 
-		size_t junk = 0;
-		ValuePtr vp = Sexpr::decode_value(it->value().ToString(), junk);
+		ValuePtr vp = getSeries(rks, it->value().ToString());
 		if (vp) vp = as->add_atoms(vp);
 
 		if (as)
@@ -645,8 +868,7 @@ void RocksStorage::getKeysMulti(AtomSpace* as,
 		Handle key = getAtom(rks.substr(kidoff));
 		key = as->add_atom(key);
 
-		size_t junk = 0;
-		ValuePtr vp = Sexpr::decode_value(it->value().ToString(), junk);
+		ValuePtr vp = getSeries(rks, it->value().ToString());
 		if (vp) vp = as->add_atoms(vp);
 
 		// hv is null first time through the loop.
@@ -1023,6 +1245,13 @@ void RocksStorage::removeSatom(const std::string& satom,
 	for (it->Seek(pfx); it->Valid() and it->key().starts_with(pfx); it->Next())
 		_rfile->Delete(rocksdb::WriteOptions(), it->key());
 	delete it;
+
+	// ... and any time-series chunks.
+	pfx = "t@" + sid + ":";
+	it = _rfile->NewIterator(rocksdb::ReadOptions());
+	for (it->Seek(pfx); it->Valid() and it->key().starts_with(pfx); it->Next())
+		_rfile->Delete(rocksdb::WriteOptions(), it->key());
+	delete it;
 }
 
 // =========================================================
@@ -1294,10 +1523,20 @@ void RocksStorage::storeAtomSpace(const AtomSpace* table)
 	// compaction manually, by calling CompactRange(NULL, NULL);
 	// which will then set up the levels correctly.
 
-	HandleSeq all_atoms;
-	table->get_handles_by_type(all_atoms, ATOM, true);
-	for (const Handle& h : all_atoms)
-		storeAtom(h);
+	// A single AtomSpace can be written from a snapshot; this avoids
+	// copying all of the Atoms, and does not block other writers.
+	if (table->getEnviron().empty())
+	{
+		table->get_snapshot().foreach_atom(ATOM, true,
+			[&](const Handle& h) { storeAtom(h); });
+	}
+	else
+	{
+		HandleSeq all_atoms;
+		table->get_handles_by_type(all_atoms, ATOM, true);
+		for (const Handle& h : all_atoms)
+			storeAtom(h);
+	}
 
 	if (_multi_space)
 	{
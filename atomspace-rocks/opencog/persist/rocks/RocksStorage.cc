@@ -124,6 +124,10 @@ void RocksStorage::init(const char * uri)
 	it->Seek("f@");
 	if (it->Valid() and it->key().starts_with("f@"))
 		_multi_space = true;
+
+	// Does it hold any time series?
+	it->Seek("t@");
+	_have_series = it->Valid() and it->key().starts_with("t@");
 	delete it;
 
 	// Verify the version number.
@@ -186,7 +190,9 @@ RocksStorage::RocksStorage(std::string uri) :
 	StorageNode(ROCKS_STORAGE_NODE, std::move(uri)),
 	_rfile(nullptr),
 	_multi_space(false),
-	_next_aid(0)
+	_next_aid(0),
+	_series_sweep(64),
+	_have_series(false)
 {
 	const char *yuri = _name.c_str();
 
@@ -225,6 +231,8 @@ void RocksStorage::close()
 	_multi_space = false;
 	_frame_map.clear();
 	_fid_map.clear();
+	_series.clear();
+	_have_series = false;
 }
 
 std::string RocksStorage::get_version(void)
@@ -311,6 +319,8 @@ std::string RocksStorage::monitor(void)
 	rs += " i@: " + std::to_string(count_records("i@"));
 	rs += " h@: " + std::to_string(count_records("h@"));
 	rs += "\n";
+	rs += "  Time-series chunks t@: " + std::to_string(count_records("t@"));
+	rs += "\n";
 
 	if (_multi_space)
 	{
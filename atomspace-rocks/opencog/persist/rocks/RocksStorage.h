@@ -35,6 +35,7 @@
 #include <mutex>
 #include "rocksdb/db.h"
 
+#include <opencog/atoms/value/FloatSeriesValue.h>
 #include <opencog/atomspace/AtomSpace.h>
 #include <opencog/persist/api/StorageNode.h>
 
@@ -83,6 +84,26 @@ class RocksStorage : public StorageNode
 		void write_aid(void);
 		std::string get_new_aid(void);
 
+		// Time series are appended to incrementally, but only when the
+		// series being stored is the same one whose samples are already
+		// on disk. The header on disk records the epoch under which the
+		// chunks were written; this records which in-memory series was
+		// last stored or loaded, and under which epoch.
+		struct SeriesTag
+		{
+			std::weak_ptr<FloatSeriesValue> fsv;
+			uint64_t epoch;
+		};
+		std::mutex _mtx_series;
+		std::unordered_map<std::string, SeriesTag> _series;
+		size_t _series_sweep;
+		std::atomic_bool _have_series;   // True if there are any t@ records.
+		void tagSeries(const std::string&, const FloatSeriesValuePtr&,
+		               uint64_t);
+		bool isTagged(const std::string&, const FloatSeriesValuePtr&,
+		              uint64_t);
+		void dropSeries(const std::string&);
+
 		// Special case (PredicateNode "*-TruthValueKey-*")
 		std::string tv_pred_sid;
 
@@ -97,10 +118,13 @@ class RocksStorage : public StorageNode
 		void remFromSidList(const std::string&, const std::string&);
 		void storeValue(const std::string& skid,
 		                const ValuePtr& vp);
+		void storeSeries(const std::string& skid,
+		                 const FloatSeriesValuePtr&);
 		void storeMissingAtom(AtomSpace*, const Handle&);
 		void doRemoveAtom(const Handle&, bool recursive);
 
 		ValuePtr getValue(const std::string&);
+		ValuePtr getSeries(const std::string&, const std::string&);
 		Handle getAtom(const std::string&);
 		Handle findAlpha(const Handle&, const std::string&, std::string&);
 		void getKeysMonospace(AtomSpace*, const std::string&, const Handle&);
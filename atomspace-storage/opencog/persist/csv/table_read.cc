@@ -23,10 +23,19 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
  */
 #include <atomic>
+#include <charconv>
+#include <deque>
+#include <exception>
 #include <iomanip>
+#include <iterator>
+#include <string_view>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
-#include <boost/algorithm/string.hpp>
-#include <boost/tokenizer.hpp>
 #include <boost/range/algorithm/transform.hpp>
 #include <boost/range/algorithm/sort.hpp>
 #include <boost/range/irange.hpp>
@@ -112,42 +121,105 @@ std::istream& get_data_line(std::istream& is, std::string& line)
 
 // -------------------------------------------------------
 
-typedef boost::tokenizer<boost::escaped_list_separator<char>> table_tokenizer;
+// Data lines are handled as views into the (memory-mapped) file
+// buffer; only tokens that contain quotes or escapes get copied.
 
-/**
- * Take a row, return a tokenizer.  Tokenization uses the
- * separator characters comma, blank, tab (',', ' ' or '\t').
- */
-static table_tokenizer get_row_tokenizer(const std::string& line)
+static bool is_separator(const char c)
 {
-	typedef boost::escaped_list_separator<char> separator;
-	typedef boost::tokenizer<separator> tokenizer;
+	return ',' == c or '\t' == c or ' ' == c;
+}
 
-	// Tokenize line; currently, we allow tabs, commas, blanks.
-	static const separator sep("\\", ",\t ", "\"");
-	return tokenizer(line, sep);
+static bool is_blank(const char c)
+{
+	return ' ' == c or '\t' == c or '\n' == c or
+	       '\v' == c or '\f' == c or '\r' == c;
+}
+
+static std::string_view trim(std::string_view tok)
+{
+	while (tok.size() and is_blank(tok.front())) tok.remove_prefix(1);
+	while (tok.size() and is_blank(tok.back())) tok.remove_suffix(1);
+	return tok;
 }
 
 /**
- * Take a line and return a vector containing the elements parsed.
+ * Tokenize a row. Tokenization uses the separator characters comma,
+ * blank, tab (',', ' ' or '\t'). Fields may be quoted with '"', and
+ * the backslash escapes '\\', '\"' and '\n' are recognized. (This is
+ * the same syntax as boost::escaped_list_separator.) Empty tokens are
+ * dropped.
+ *
+ * The tokens are views into `line`, except for those that had quotes
+ * or escapes in them; these are unescaped into `scratch`.
  */
-static std::vector<std::string> tokenizeRow (const std::string& line)
+static void tokenize_row(std::string_view line,
+                         std::vector<std::string_view>& toks,
+                         std::deque<std::string>& scratch)
 {
-	table_tokenizer tok = get_row_tokenizer(line);
-	std::vector<std::string> res;
-	for (const std::string& t : tok)
+	toks.clear();
+	scratch.clear();
+
+	size_t i = 0;
+	size_t n = line.size();
+	while (true)
 	{
+		size_t start = i;
+		bool simple = true;
+		bool in_quote = false;
+		std::string buf;
+		for (; i < n; i++)
+		{
+			char c = line[i];
+			if ('\\' == c or '"' == c)
+			{
+				if (simple)
+				{
+					buf.assign(line.substr(start, i - start));
+					simple = false;
+				}
+				if ('"' == c) { in_quote = not in_quote; continue; }
+
+				i++;
+				if (n <= i or ('\\' != line[i] and '"' != line[i]
+				               and 'n' != line[i]))
+					throw SyntaxException(TRACE_INFO,
+						"Invalid escape sequence in line: %s",
+						std::string(line).c_str());
+				buf.push_back('n' == line[i] ? '\n' : line[i]);
+				continue;
+			}
+			if (not in_quote and is_separator(c)) break;
+			if (not simple) buf.push_back(c);
+		}
+
+		std::string_view tok;
+		if (simple) tok = line.substr(start, i - start);
+		else tok = scratch.emplace_back(std::move(buf));
+
 		// Trim away whitespace padding; failing to do this
 		// confuses stuff downstream.
-		std::string clean(t);
-		boost::trim(clean);
+		tok = trim(tok);
 
-		// Sometimes the tokenizer returns pure whitespace :-(
-		if (0 == clean.size()) continue;
+		// Adjacent separators produce pure whitespace; skip these.
+		if (0 < tok.size()) toks.push_back(tok);
 
-		res.push_back(clean);
+		if (n <= i) break;
+		i++;
 	}
-	return res;
+}
+
+/**
+ * Convert a token to a double, without going through a locale or
+ * a stringstream. Returns false if the token is not entirely a
+ * number.
+ */
+static bool parse_double(std::string_view tok, double& d)
+{
+	// from_chars does not accept a leading plus sign.
+	if (1 < tok.size() and '+' == tok[0]) tok.remove_prefix(1);
+	const char* end = tok.data() + tok.size();
+	auto [ptr, ec] = std::from_chars(tok.data(), end, d);
+	return std::errc() == ec and ptr == end;
 }
 
 // -------------------------------------------------------
@@ -155,7 +227,7 @@ static std::vector<std::string> tokenizeRow (const std::string& line)
  * Given an input string, guess the type of the string.
  * Inferable types are: boolean, contin and enum.
  */
-static Type infer_type_from_token(const std::string& token)
+static Type infer_type_from_token(std::string_view token)
 {
     /* Preferred representation is T's and 0's, to maximize clarity,
      * readability.  Numeric values are easily confused with floating
@@ -175,13 +247,10 @@ static Type infer_type_from_token(const std::string& token)
 
     // Hope that we can cast this to a float point number.
     else {
-        try {
-            boost::lexical_cast<double>(token);
+        double d;
+        if (parse_double(token, d))
             return FLOAT_VALUE;
-        }
-        catch(...) {
-            return VOID_VALUE;
-        }
+        return VOID_VALUE;
     }
 }
 
@@ -192,7 +261,7 @@ static Type infer_type_from_token(const std::string& token)
  * if it can be done consistently.
  */
 static Type
-infer_type_from_token2(Type curr_guess, const std::string& token)
+infer_type_from_token2(Type curr_guess, std::string_view token)
 {
     Type tokt = infer_type_from_token(token);
 
@@ -226,6 +295,17 @@ static const char *sparse_delim = " : ";
 
 typedef std::vector<string_seq> ITable;
 
+/**
+ * Take a line and return a vector containing the elements parsed.
+ */
+static std::vector<std::string> tokenizeRow (const std::string& line)
+{
+	std::vector<std::string_view> toks;
+	std::deque<std::string> scratch;
+	tokenize_row(line, toks, scratch);
+	return std::vector<std::string>(toks.begin(), toks.end());
+}
+
 /**
  * Fill the input table, given a file in DSV (delimiter-seperated values)
  * format.  The delimiters are ',', ' ' or '\t'.
@@ -365,8 +445,39 @@ get_indices(const string_seq &labels,
 
 // ==================================================================
 
-static std::istream&
-inferTableAttributes(std::istream& in,
+/// Get one line of actual data out of a buffer, advancing `pos`.
+/// This is the same as get_data_line(), above, except that it works
+/// on an in-RAM buffer, and returns a view, instead of a copy.
+static bool next_data_line(std::string_view buf, size_t& pos,
+                           std::string_view& line)
+{
+	while (pos < buf.size())
+	{
+		size_t eol = buf.find('\n', pos);
+		if (std::string_view::npos == eol) eol = buf.size();
+		line = buf.substr(pos, eol - pos);
+		pos = eol + 1;
+
+		if (0 == line.size() or is_comment(line[0])) continue;
+
+		// Remove weird symbols at the start of the line (only).
+		while (line.size() and (unsigned char) line[0] > 127)
+			line.remove_prefix(1);
+
+		// Remove carriage return at end of line (for DOS files).
+		if (line.size() and '\r' == line.back())
+			line.remove_suffix(1);
+
+		if (0 == line.size()) continue;
+		return true;
+	}
+	return false;
+}
+
+// ==================================================================
+
+static void
+inferTableAttributes(std::string_view buf,
                      const std::vector<std::string>& ignore_features,
                      std::vector<unsigned>& ignore_idxs,
                      std::vector<Type>& types,
@@ -375,24 +486,29 @@ inferTableAttributes(std::istream& in,
 {
 	has_header = false;
 
-	std::streampos beg = in.tellg();
-
 	// maxline is the maximum number of lines to read to infer the
-	// attributes. A negative number means reading all lines.
+	// attributes.
 	int maxline = 20;
 
-	// Get a portion of the dataset into memory (cleaning weird stuff)
-	std::vector<std::string> lines;
-	std::string line;
-	while (get_data_line(in, line) and 0 < maxline--)
+	// Get a portion of the dataset (cleaning weird stuff)
+	std::vector<std::string_view> lines;
+	std::string_view line;
+	size_t pos = 0;
+	while (0 < maxline-- and next_data_line(buf, pos, line))
 		lines.push_back(line);
 
+	if (0 == lines.size())
+		throw SyntaxException(TRACE_INFO,
+			"ERROR: Input file does not contain any data.\n");
+
 	// Parse what could be a header
-	maybe_header = tokenizeRow(lines.front());
+	std::vector<std::string_view> tokens;
+	std::deque<std::string> scratch;
+	tokenize_row(lines.front(), tokens, scratch);
+	maybe_header.assign(tokens.begin(), tokens.end());
 
 	// Determine arity
 	size_t arity = maybe_header.size();
-	std::atomic<int> arity_fail_row(-1);
 
 	// Determine initial type
 	types.resize(arity, VOID_VALUE);
@@ -402,20 +518,15 @@ inferTableAttributes(std::istream& in,
 	for (size_t i = 1; i < lines.size(); ++i)
 	{
 		// Parse line
-		const string_seq& tokens = tokenizeRow(lines[i]);
+		tokenize_row(lines[i], tokens, scratch);
 
 		// Check arity
 		if (arity != tokens.size())
-		{
-			arity_fail_row = i + 1;
-			in.seekg(beg);
-			in.clear();		 // in case it has reached the eof
 			throw SyntaxException(TRACE_INFO,
 				"ERROR: Input file inconsistent: the %uth row has a "
 				"different number of columns than the rest of the file.  "
 				"All rows should have the same number of columns.\n",
-				arity_fail_row.load());
-		}
+				i + 1);
 
 		// Infer type
 		boost::transform(types, tokens, types.begin(),
@@ -431,16 +542,12 @@ inferTableAttributes(std::istream& in,
 		ignore_idxs = get_indices(ignore_features, maybe_header);
 		boost::sort(ignore_idxs);
 	}
-
-	in.seekg(beg);
-	in.clear();		 // in case it has reached the eof
-	return in;
 }
 
 // ==================================================================
 
 /// cast string "token" to a vertex of type "tipe"
-static bool token_to_bool(const std::string& token)
+static bool token_to_bool(std::string_view token)
 {
 	if ("0" == token || "F" == token || "f" == token)
 		return false;
@@ -449,112 +556,200 @@ static bool token_to_bool(const std::string& token)
 		return true;
 
 	throw SyntaxException(TRACE_INFO,
-		"Expecting boolean value, got %s", token.c_str());
+		"Expecting boolean value, got %s", std::string(token).c_str());
 }
 
-static double token_to_contin(const std::string& token)
-{
-	try {
-		return boost::lexical_cast<double>(token);
-	} catch (boost::bad_lexical_cast&) {
-		throw SyntaxException(TRACE_INFO,
-			"Could not cast %s to floating point", token.c_str());
-	}
-}
-
-// See header file for `load_csv_table` for a general description
-// of what is being done here.  In brief, columns from a table
-// are jammed into individual values on a given atom.
-static std::istream&
-istreamDenseTable(const AtomSpacePtr& as,
-                  const Handle& anchor,
-                  std::istream& in,
-                  const std::vector<unsigned>& ignore_idxs,
-                  const std::vector<Type>& col_types,
-                  const std::vector<std::string>& header,
-                  bool has_header)
+static double token_to_contin(std::string_view token)
 {
-	// Width of table in the input.
-	size_t table_width = col_types.size();
+	double d;
+	if (parse_double(token, d)) return d;
 
-	// Effective width is the width, without the ignored columns.
-	// size_t effective_width = table_width - ignore_idxs.size();
+	throw SyntaxException(TRACE_INFO,
+		"Could not cast %s to floating point", std::string(token).c_str());
+}
 
-	// Setup a mask; should we skip the column?
-	std::vector<bool> skip_col(table_width, false);
-	for (unsigned i : ignore_idxs)
-		skip_col[i] = true;
+// ==================================================================
 
-	// Set up typed columns.  They're empty at first.
+/// The typed columns parsed out of one chunk of the table.
+struct TableChunk
+{
 	std::vector<std::vector<bool>> bool_cols;
 	std::vector<std::vector<double>> float_cols;
 	std::vector<std::vector<std::string>> string_cols;
+};
+
+/// Parse all of the rows in `chunk` directly into typed columns.
+/// Thread-safe; each thread gets its own chunk.
+static void
+parseDenseChunk(std::string_view chunk,
+                const std::vector<bool>& skip_col,
+                const std::vector<Type>& col_types,
+                TableChunk& tc)
+{
+	size_t table_width = col_types.size();
 
+	// Set up typed columns.  They're empty at first.
 	for (size_t ic = 0; ic < table_width; ic++)
 	{
 		if (skip_col[ic]) continue;
 		if (BOOL_VALUE == col_types[ic])
-			bool_cols.push_back(std::vector<bool>());
+			tc.bool_cols.push_back(std::vector<bool>());
 		else
 		if (FLOAT_VALUE == col_types[ic])
-			float_cols.push_back(std::vector<double>());
+			tc.float_cols.push_back(std::vector<double>());
 		else
 		if (STRING_VALUE == col_types[ic])
-			string_cols.push_back(std::vector<std::string>());
+			tc.string_cols.push_back(std::vector<std::string>());
 		else
 			throw RuntimeException(TRACE_INFO,
 				"Unhandled column type");
 	}
 
-	// ----------------------------------------------
-	std::string line;
-
-	// Assume the stream is at the beginning.
-	// If there is a header, skip one line.
-	if (has_header)
-		get_data_line(in, line);
-
-	// Loop over all lines in the table, one by one.
+	// Loop over all lines in the chunk, one by one.
 	// Stuff the desired columns into each of the columns
 	// we created above.
-	while (get_data_line(in, line))
+	std::vector<std::string_view> toks;
+	std::deque<std::string> scratch;
+	std::string_view line;
+	size_t pos = 0;
+	while (next_data_line(chunk, pos, line))
 	{
-		size_t ic = 0;
+		tokenize_row(line, toks, scratch);
+		if (table_width != toks.size())
+			throw SyntaxException(TRACE_INFO,
+				"ERROR: Input file inconsistent: the row\n%s\n"
+				"has %zu columns; expecting %zu columns.\n",
+				std::string(line).c_str(), toks.size(), table_width);
+
 		size_t bc = 0;
 		size_t fc = 0;
 		size_t sc = 0;
-		std::vector<std::string> toks = tokenizeRow(line);
-		for (const std::string& tok : toks)
+		for (size_t ic = 0; ic < table_width; ic++)
 		{
-			if (skip_col[ic]) { ic++; continue; }
+			if (skip_col[ic]) continue;
 			if (BOOL_VALUE == col_types[ic])
-			{
-				bool_cols[bc].push_back(token_to_bool(tok));
-				bc ++;
-				ic ++;
-				continue;
-			}
+				tc.bool_cols[bc++].push_back(token_to_bool(toks[ic]));
 
-			if (FLOAT_VALUE == col_types[ic])
-			{
-				float_cols[fc].push_back(token_to_contin(tok));
-				fc ++;
-				ic ++;
-				continue;
-			}
+			else if (FLOAT_VALUE == col_types[ic])
+				tc.float_cols[fc++].push_back(token_to_contin(toks[ic]));
 
-			if (STRING_VALUE == col_types[ic])
-			{
-				string_cols[sc].push_back(tok);
-				sc ++;
-				ic ++;
-				continue;
-			}
+			else
+				tc.string_cols[sc++].emplace_back(toks[ic]);
+		}
+	}
+}
 
-			throw RuntimeException(TRACE_INFO,
-				"Unhandled column type");
+/// Split the buffer into roughly equal chunks, on line boundaries.
+static std::vector<std::string_view>
+split_chunks(std::string_view buf)
+{
+	// Small tables are not worth the thread startup cost.
+	static const size_t MIN_CHUNK = 1024 * 1024;
+	size_t nchunks = std::thread::hardware_concurrency();
+	nchunks = std::min(nchunks, buf.size() / MIN_CHUNK);
+	if (0 == nchunks) nchunks = 1;
+
+	std::vector<std::string_view> chunks;
+	size_t step = buf.size() / nchunks + 1;
+	size_t start = 0;
+	while (start < buf.size())
+	{
+		size_t end = start + step;
+		if (buf.size() <= end)
+			end = buf.size();
+		else
+		{
+			end = buf.find('\n', end);
+			end = (std::string_view::npos == end) ? buf.size() : end + 1;
+		}
+		chunks.push_back(buf.substr(start, end - start));
+		start = end;
+	}
+
+	// Always at least one, even if it is empty.
+	if (chunks.empty()) chunks.push_back(buf);
+	return chunks;
+}
+
+/// Append the chunk columns, in order, to the first one.
+template<typename T>
+static void concat_columns(std::vector<TableChunk>& tcs,
+                           std::vector<std::vector<T>> TableChunk::* cols)
+{
+	std::vector<std::vector<T>>& dest = tcs[0].*cols;
+	for (size_t c = 0; c < dest.size(); c++)
+	{
+		size_t total = 0;
+		for (const TableChunk& tc : tcs) total += (tc.*cols)[c].size();
+		dest[c].reserve(total);
+		for (size_t i = 1; i < tcs.size(); i++)
+		{
+			std::vector<T>& src = (tcs[i].*cols)[c];
+			dest[c].insert(dest[c].end(),
+			               std::make_move_iterator(src.begin()),
+			               std::make_move_iterator(src.end()));
+			std::vector<T>().swap(src);
 		}
 	}
+}
+
+// See header file for `load_csv_table` for a general description
+// of what is being done here.  In brief, columns from a table
+// are jammed into individual values on a given atom.
+//
+// The table body is split into chunks on line boundaries; each chunk
+// is parsed by its own thread, straight into typed columns. The chunk
+// columns are then concatenated, in order.
+static void
+loadDenseTable(const AtomSpacePtr& as,
+               const Handle& anchor,
+               std::string_view buf,
+               const std::vector<unsigned>& ignore_idxs,
+               const std::vector<Type>& col_types,
+               const std::vector<std::string>& header,
+               bool has_header)
+{
+	// Width of table in the input.
+	size_t table_width = col_types.size();
+
+	// Setup a mask; should we skip the column?
+	std::vector<bool> skip_col(table_width, false);
+	for (unsigned i : ignore_idxs)
+		skip_col[i] = true;
+
+	// If there is a header, skip one line.
+	size_t pos = 0;
+	std::string_view line;
+	if (has_header)
+	{
+		next_data_line(buf, pos, line);
+		buf.remove_prefix(std::min(pos, buf.size()));
+	}
+
+	std::vector<std::string_view> chunks = split_chunks(buf);
+	std::vector<TableChunk> tcs(chunks.size());
+	std::vector<std::exception_ptr> errs(chunks.size());
+	std::vector<std::thread> thrs;
+	for (size_t i = 1; i < chunks.size(); i++)
+	{
+		thrs.push_back(std::thread([&, i]() {
+			try { parseDenseChunk(chunks[i], skip_col, col_types, tcs[i]); }
+			catch (...) { errs[i] = std::current_exception(); }
+		}));
+	}
+
+	// Do the first chunk here, in this thread.
+	try { parseDenseChunk(chunks[0], skip_col, col_types, tcs[0]); }
+	catch (...) { errs[0] = std::current_exception(); }
+
+	for (std::thread& t : thrs) t.join();
+	for (const std::exception_ptr& ep : errs)
+		if (ep) std::rethrow_exception(ep);
+
+	concat_columns(tcs, &TableChunk::bool_cols);
+	concat_columns(tcs, &TableChunk::float_cols);
+	concat_columns(tcs, &TableChunk::string_cols);
+	TableChunk& tc = tcs[0];
 
 	// Now that we've read everything in,
 	// place the individual columns into Values,
@@ -571,13 +766,13 @@ istreamDenseTable(const AtomSpacePtr& as,
 
 		ValuePtr vp;
 		if (BOOL_VALUE == col_types[ic])
-			vp = createBoolValue(bool_cols[bc++]);
+			vp = createBoolValue(tc.bool_cols[bc++]);
 
 		else if (FLOAT_VALUE == col_types[ic])
-			vp = createFloatValue(float_cols[fc++]);
+			vp = createFloatValue(std::move(tc.float_cols[fc++]));
 
 		else if (STRING_VALUE == col_types[ic])
-			vp = createStringValue(string_cols[sc++]);
+			vp = createStringValue(std::move(tc.string_cols[sc++]));
 
 		else
 			throw RuntimeException(TRACE_INFO,
@@ -593,8 +788,6 @@ istreamDenseTable(const AtomSpacePtr& as,
 	Handle klp = as->add_node(PREDICATE_NODE, "*-column-keys-*");
 	ValuePtr kvp = createLinkValue(keylist);
 	as->set_value(anchor, klp, kvp);
-
-	return in;
 }
 
 // ==================================================================
@@ -609,20 +802,17 @@ istreamDenseTable(const AtomSpacePtr& as,
  *
  * 2) Load the actual data.
  */
-std::istream&
-opencog::istreamTable(const AtomSpacePtr& as,
+static void loadTable(const AtomSpacePtr& as,
                       const Handle& anchor,
-                      std::istream& in,
+                      std::string_view buf,
                       const std::vector<std::string>& ignore_features)
 {
-	std::streampos beg = in.tellg();
-
 	// Infer the properties of the table without loading its content
 	std::vector<unsigned> ignore_indexes;
 	std::vector<Type> col_types;
 	std::vector<std::string> header;
 	bool has_header = false;
-	inferTableAttributes(in, ignore_features, ignore_indexes,
+	inferTableAttributes(buf, ignore_features, ignore_indexes,
 	                     col_types, header, has_header);
 
 	// If the header is missing, then fake it.
@@ -633,14 +823,63 @@ opencog::istreamTable(const AtomSpacePtr& as,
 			header.push_back("c" + std::to_string(i));
 	}
 
-	in.seekg(beg);
-
-	return istreamDenseTable(as, anchor, in, ignore_indexes,
+	loadDenseTable(as, anchor, buf, ignore_indexes,
 		col_types, header, has_header);
 }
 
+// Same as above, but for an already-open stream. The stream is
+// slurped into RAM, and parsed there.
+std::istream&
+opencog::istreamTable(const AtomSpacePtr& as,
+                      const Handle& anchor,
+                      std::istream& in,
+                      const std::vector<std::string>& ignore_features)
+{
+	std::string buf((std::istreambuf_iterator<char>(in)),
+	                std::istreambuf_iterator<char>());
+
+	loadTable(as, anchor, buf, ignore_features);
+	return in;
+}
+
 // ==================================================================
 
+/// Read-only memory map of an entire file. Unmapped when destroyed.
+class MappedFile
+{
+	void* _addr = MAP_FAILED;
+	size_t _len = 0;
+
+public:
+	MappedFile(const std::string& file_name)
+	{
+		int fd = open(file_name.c_str(), O_RDONLY);
+		if (fd < 0) return;
+
+		struct stat st;
+		if (0 == fstat(fd, &st) and S_ISREG(st.st_mode) and 0 < st.st_size)
+		{
+			_len = st.st_size;
+			_addr = mmap(nullptr, _len, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (MAP_FAILED != _addr)
+				madvise(_addr, _len, MADV_SEQUENTIAL);
+		}
+		close(fd);
+	}
+	~MappedFile()
+	{
+		if (MAP_FAILED != _addr) munmap(_addr, _len);
+	}
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	bool is_mapped() const { return MAP_FAILED != _addr; }
+	std::string_view view() const
+	{
+		return std::string_view((const char*) _addr, _len);
+	}
+};
+
 // See header file for general description.
 void opencog::load_csv_table(const AtomSpacePtr& as,
                              const Handle& anchor,
@@ -649,12 +888,22 @@ void opencog::load_csv_table(const AtomSpacePtr& as,
 {
 	if (file_name.empty())
 		throw RuntimeException(TRACE_INFO, "The file name is empty!");
+
+	// Map the file, if we can; this avoids copying it into RAM.
+	MappedFile mf(file_name);
+	if (mf.is_mapped())
+	{
+		loadTable(as, anchor, mf.view(), ignore_features);
+		return;
+	}
+
+	// Pipes, empty files and the like go through a stream.
 	std::ifstream in(file_name.c_str());
 	if (not in.is_open())
 		throw RuntimeException(TRACE_INFO,
 			"Could not open %s", file_name.c_str());
 
-    istreamTable(as, anchor, in, ignore_features);
+	istreamTable(as, anchor, in, ignore_features);
 }
 
 // ==================================================================
@@ -211,14 +211,26 @@ void FileStorageNode::storeAtomSpace(const AtomSpace* table)
 		throw IOException(TRACE_INFO,
 		"FileStorageNode %s is not open!", _filename.c_str());
 
-	HandleSeq hset;
-	table->get_handles_by_type(hset, ATOM, true);
-	for(const Handle& h: hset)
+	// Store roots, and Atoms that have values.
+	// All other Atoms will appear in outgoing sets.
+	auto store = [&](const Handle& h)
 	{
-		// Store roots, and Atoms that have values.
-		// All other Atoms will appear in outgoing sets.
 		if (h->haveValues() or 0 == h->getIncomingSetSize())
 			storeAtom(h);
+	};
+
+	// A single AtomSpace can be written from a snapshot; this avoids
+	// copying all of the Atoms, and does not block other writers.
+	if (table->getEnviron().empty())
+	{
+		table->get_snapshot().foreach_atom(ATOM, true, store);
+	}
+	else
+	{
+		HandleSeq hset;
+		table->get_handles_by_type(hset, ATOM, true);
+		for (const Handle& h: hset)
+			store(h);
 	}
 
 	fflush(_fh);
@@ -42,6 +42,20 @@ Handle opencog::parseStream(std::istream& in, AtomSpacePtr asp)
     cmd.set_base_space(asp);
     static std::unordered_map<std::string, Handle> ascache; // empty, not currently used.
     Handle h;
+
+    // Atoms are added in batches; this is much faster than adding
+    // them one at a time. The batch must be flushed before running
+    // any commands, as those might refer to the atoms in it.
+    static const size_t BATCH_SIZE = 1024;
+    HandleSeq batch;
+    auto flush = [&]()
+    {
+        if (batch.empty()) return;
+        HandleSeq added(asp->add_atoms(std::move(batch)));
+        h = added.back();
+        batch.clear();
+    };
+
     size_t expr_cnt = 0;
     size_t line_cnt = 0;
     int pcount = 0;
@@ -83,10 +97,13 @@ Handle opencog::parseStream(std::istream& in, AtomSpacePtr asp)
             // command.
             try
             {
-                h = asp->add_atom(Sexpr::decode_atom(expr, l, r, line_cnt, ascache));
+                batch.emplace_back(
+                    Sexpr::decode_atom(expr, l, r, line_cnt, ascache));
+                if (BATCH_SIZE <= batch.size()) flush();
             }
             catch (const SyntaxException& ex)
             {
+                flush();
                 cmd.interpret_command(expr.substr(l));
             }
 
@@ -94,6 +111,8 @@ Handle opencog::parseStream(std::istream& in, AtomSpacePtr asp)
         }
     }
 
+    flush();
+
     if (0 < pcount)
         throw std::runtime_error(
             "Unbalanced parenthesis >>" + expr.substr(r) + "<<");
@@ -36,9 +36,42 @@ TLB::TLB(uuid_pool* allocator)
 
 void TLB::clear()
 {
-    std::lock_guard<std::mutex> lck(_mtx);
-    _handle_map.clear();
-    _uuid_map.clear();
+    for (HandleShard& hs : _handle_shards)
+    {
+        std::unique_lock<std::shared_mutex> lck(hs.mtx);
+        hs.map.clear();
+    }
+    for (UuidShard& us : _uuid_shards)
+    {
+        std::unique_lock<std::shared_mutex> lck(us.mtx);
+        us.map.clear();
+    }
+}
+
+size_t TLB::size()
+{
+    size_t cnt = 0;
+    for (const UuidShard& us : _uuid_shards)
+    {
+        std::shared_lock<std::shared_mutex> lck(us.mtx);
+        cnt += us.map.size();
+    }
+    return cnt;
+}
+
+void TLB::reserve(size_t nelts)
+{
+    size_t per_shard = nelts / NUM_SHARDS + 1;
+    for (HandleShard& hs : _handle_shards)
+    {
+        std::unique_lock<std::shared_mutex> lck(hs.mtx);
+        hs.map.reserve(per_shard);
+    }
+    for (UuidShard& us : _uuid_shards)
+    {
+        std::unique_lock<std::shared_mutex> lck(us.mtx);
+        us.map.reserve(per_shard);
+    }
 }
 
 // ===================================================
@@ -84,19 +117,27 @@ UUID TLB::addAtom(const Handle& h, UUID uuid)
             addAtom(ho, TLB::INVALID_UUID);
     }
 
-    std::lock_guard<std::mutex> lck(_mtx);
+    // Both h and hr have the same content hash, and so live in the
+    // same shard. Holding this lock serializes all updates for this
+    // atom; the uuid shards are locked only briefly, below.
+    HandleShard& hs = hshard(hr);
+    std::unique_lock<std::shared_mutex> hlck(hs.mtx);
 
     // If we hold something that isn't the atomspace's version,
     // then remove it. Only the atomspace's version has the
     // correct values (including the TV) on it.
     if (hr != h)
     {
-        auto pr = _handle_map.find(h);
-        if (_handle_map.end() != pr)
+        auto pr = hs.map.find(h);
+        if (hs.map.end() != pr)
         {
             UUID oid = pr->second;
-            _handle_map.erase(pr);
-            _uuid_map.erase(oid);
+            hs.map.erase(pr);
+            {
+                UuidShard& us = ushard(oid);
+                std::unique_lock<std::shared_mutex> ulck(us.mtx);
+                us.map.erase(oid);
+            }
 
             OC_ASSERT(uuid == INVALID_UUID or oid == uuid,
                      "Earlier version of atom has mis-matched UUID!");
@@ -106,66 +147,93 @@ UUID TLB::addAtom(const Handle& h, UUID uuid)
         }
     }
 
-    auto pr = _handle_map.find(hr);
+    auto pr = hs.map.find(hr);
     if (uuid == INVALID_UUID)
     {
-        if (_handle_map.end() != pr) return pr->second;
+        if (hs.map.end() != pr) return pr->second;
 
         while (true)
         {
             // Not found; we need a new uuid.
             uuid = _uuid_pool->get_uuid();
 
-            // Oh wait, is it being used already?
-            auto pr = _uuid_map.find(uuid);
-            if (_uuid_map.end() == pr) break;
+            // Oh wait, is it being used already? Claim it under
+            // the shard lock, so that no one else can grab it.
+            UuidShard& us = ushard(uuid);
+            std::unique_lock<std::shared_mutex> ulck(us.mtx);
+            if (us.map.emplace(uuid, hr).second) break;
         }
+        hs.map.emplace(hr, uuid);
+        return uuid;
     }
-    else
+
+    if (hs.map.end() != pr)
     {
-        if (_handle_map.end() != pr)
-        {
-            OC_ASSERT(uuid == pr->second,
-                     "Atom is already in the TLB, and UUID's don't match!");
-
-            // If the atom that we are holding is in the same atomspace
-            // as the resolved atom, then we are done. Otherwise, we
-            // need to replace it with the version with the indicated
-            // atomspace. That is because atoms in different atomspaces
-            // will hold different values and TV's.
-
-            AtomSpace* has = hr->getAtomSpace();
-            AtomSpace* pas = pr->first->getAtomSpace();
-            if (pas and has and pas == has)
-                return uuid;
-
-            _handle_map.erase(pr);
-            _uuid_map.erase(uuid);
-        }
+        OC_ASSERT(uuid == pr->second,
+                 "Atom is already in the TLB, and UUID's don't match!");
+
+        // If the atom that we are holding is in the same atomspace
+        // as the resolved atom, then we are done. Otherwise, we
+        // need to replace it with the version with the indicated
+        // atomspace. That is because atoms in different atomspaces
+        // will hold different values and TV's.
+
+        AtomSpace* has = hr->getAtomSpace();
+        AtomSpace* pas = pr->first->getAtomSpace();
+        if (pas and has and pas == has)
+            return uuid;
+
+        hs.map.erase(pr);
+        UuidShard& us = ushard(uuid);
+        std::unique_lock<std::shared_mutex> ulck(us.mtx);
+        us.map.erase(uuid);
     }
 
-    _uuid_map.emplace(std::make_pair(uuid, hr));
-    _handle_map.emplace(std::make_pair(hr, uuid));
+    {
+        UuidShard& us = ushard(uuid);
+        std::unique_lock<std::shared_mutex> ulck(us.mtx);
+        us.map.emplace(uuid, hr);
+    }
+    hs.map.emplace(hr, uuid);
 
     return uuid;
 }
 
+std::vector<UUID> TLB::addAtoms(const HandleSeq& hs,
+                                const std::vector<UUID>& uuids)
+{
+    OC_ASSERT(hs.size() == uuids.size(),
+              "Mis-matched atom and UUID sequences!");
+
+    std::vector<UUID> result;
+    result.reserve(hs.size());
+
+    // The per-atom locks are sharded, so callers are free to
+    // run several of these in parallel.
+    for (size_t i = 0; i < hs.size(); i++)
+        result.push_back(addAtom(hs[i], uuids[i]));
+
+    return result;
+}
+
 Handle TLB::getAtom(UUID uuid)
 {
     if (INVALID_UUID == uuid) return Handle::UNDEFINED;
-    std::lock_guard<std::mutex> lck(_mtx);
-    auto pr = _uuid_map.find(uuid);
+    const UuidShard& us = ushard(uuid);
+    std::shared_lock<std::shared_mutex> lck(us.mtx);
+    auto pr = us.map.find(uuid);
 
-    if (_uuid_map.end() == pr) return Handle::UNDEFINED;
+    if (us.map.end() == pr) return Handle::UNDEFINED;
 
     return pr->second;
 }
 
 UUID TLB::getUUID(const Handle& h)
 {
-    std::lock_guard<std::mutex> lck(_mtx);
-    auto pr = _handle_map.find(h);
-    if (_handle_map.end() != pr)
+    const HandleShard& hs = hshard(h);
+    std::shared_lock<std::shared_mutex> lck(hs.mtx);
+    auto pr = hs.map.find(h);
+    if (hs.map.end() != pr)
         return pr->second;
 
     return INVALID_UUID;
@@ -186,25 +254,24 @@ UUID TLB::getUUID(const Handle& h)
 void TLB::removeAtom(UUID uuid)
 {
     if (INVALID_UUID == uuid) return;
-    std::lock_guard<std::mutex> lck(_mtx);
+    UuidShard& us = ushard(uuid);
+    std::unique_lock<std::shared_mutex> lck(us.mtx);
 
-    auto pr = _uuid_map.find(uuid);
-    if (_uuid_map.end() == pr) return;
-
-    _uuid_map.erase(uuid);
+    us.map.erase(uuid);
     // Do NOT remove from the handle_map. See note above.
-    // _handle_map.erase(pr->second);
 }
 
 void TLB::removeAtom(const Handle& h)
 {
-    std::lock_guard<std::mutex> lck(_mtx);
-    auto pr = _handle_map.find(h);
-    if (_handle_map.end() != pr)
+    HandleShard& hs = hshard(h);
+    std::shared_lock<std::shared_mutex> hlck(hs.mtx);
+    auto pr = hs.map.find(h);
+    if (hs.map.end() != pr)
     {
-        _uuid_map.erase(pr->second);
+        UuidShard& us = ushard(pr->second);
+        std::unique_lock<std::shared_mutex> ulck(us.mtx);
+        us.map.erase(pr->second);
         // Do NOT remove from the handle_map. See note above.
-        // _handle_map.erase(pr);
     }
 }
 
@@ -216,12 +283,23 @@ void TLB::removeAtom(const Handle& h)
 void TLB::purgeAtom(UUID uuid)
 {
     if (INVALID_UUID == uuid) return;
-    std::lock_guard<std::mutex> lck(_mtx);
 
-    auto pr = _uuid_map.find(uuid);
-    if (_uuid_map.end() == pr) return;
+    // Find the atom first; the locks must then be taken in the
+    // usual order (handle-shard, then uuid-shard).
+    Handle h(getAtom(uuid));
+    if (nullptr == h) return;
+
+    HandleShard& hs = hshard(h);
+    std::unique_lock<std::shared_mutex> hlck(hs.mtx);
+    UuidShard& us = ushard(uuid);
+    std::unique_lock<std::shared_mutex> ulck(us.mtx);
+
+    // Someone else may have gotten here first.
+    auto pr = us.map.find(uuid);
+    if (us.map.end() == pr) return;
 
-    Handle h = pr->second;
-    _uuid_map.erase(uuid);
-    _handle_map.erase(h);
+    us.map.erase(pr);
+    auto hpr = hs.map.find(h);
+    if (hs.map.end() != hpr and hpr->second == uuid)
+        hs.map.erase(hpr);
 }
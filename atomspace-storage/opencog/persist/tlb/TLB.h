@@ -25,8 +25,9 @@
 #ifndef _OPENCOG_TLB_H
 #define _OPENCOG_TLB_H
 
+#include <array>
 #include <atomic>
-#include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
 
 #include <opencog/atoms/base/Atom.h>
@@ -77,11 +78,33 @@ private:
     local_uuid_pool _local_pool;
     uuid_pool* _uuid_pool;
 
-    std::mutex _mtx;
-    std::unordered_map<UUID, Handle> _uuid_map;
-    std::unordered_map<Handle, UUID,
-                      std::hash<opencog::Handle>,
-                      std::equal_to<opencog::Handle> > _handle_map;
+    // The two maps are split into shards, each with its own lock,
+    // so that parallel loaders do not serialize on a single mutex.
+    // The handle-to-uuid shards are picked by the content hash of
+    // the atom, so all content-equal handles land in the same shard.
+    // The uuid-to-handle shards are picked by the low bits of the uuid.
+    // Lock order is always handle-shard first, then uuid-shard.
+    static constexpr size_t NUM_SHARDS = 64;
+
+    struct UuidShard
+    {
+        mutable std::shared_mutex mtx;
+        std::unordered_map<UUID, Handle> map;
+    };
+    struct HandleShard
+    {
+        mutable std::shared_mutex mtx;
+        std::unordered_map<Handle, UUID,
+                          std::hash<opencog::Handle>,
+                          std::equal_to<opencog::Handle> > map;
+    };
+    std::array<UuidShard, NUM_SHARDS> _uuid_shards;
+    std::array<HandleShard, NUM_SHARDS> _handle_shards;
+
+    UuidShard& ushard(UUID uuid)
+    { return _uuid_shards[uuid % NUM_SHARDS]; }
+    HandleShard& hshard(const Handle& h)
+    { return _handle_shards[hash_value(h) % NUM_SHARDS]; }
 
     // Its a vector, not a set, because it's priority ranked.
     std::vector<const AtomSpace*> _resolver;
@@ -89,15 +112,22 @@ private:
 
 public:
 
-    static const UUID INVALID_UUID = ULONG_MAX;
+    static constexpr UUID INVALID_UUID = ULONG_MAX;
 
     TLB(uuid_pool* = nullptr);
     void set_resolver(const AtomSpace*);
     void clear_resolver(const AtomSpace*);
 
-    size_t size() { return _uuid_map.size(); }
+    size_t size();
     void clear();
 
+    /**
+     * Pre-size the maps to hold (at least) this many atoms. Bulk
+     * loaders should call this before starting, to avoid rehashing
+     * while the load is in progress.
+     */
+    void reserve(size_t);
+
     /**
      * Adds a new atom to the TLB.
      * If the atom has already been added, then an exception is thrown.
@@ -110,6 +140,13 @@ public:
     }
     UUID addAtom(const Handle&, UUID);
 
+    /**
+     * Bulk version of the above. The two sequences must be of the
+     * same length; use INVALID_UUID to request a fresh UUID for an
+     * atom. Returns the UUID's, in the same order as the atoms.
+     */
+    std::vector<UUID> addAtoms(const HandleSeq&, const std::vector<UUID>&);
+
     /** Look up atom corresponding to the UUID. */
     Handle getAtom(UUID);
 
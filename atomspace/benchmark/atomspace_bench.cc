@@ -0,0 +1,180 @@
+//
+// benchmark/atomspace_bench.cc
+//
+// Cost of the basic AtomSpace operations: creating Atoms and adding
+// them to the AtomSpace; setting, getting and incrementing Values;
+// walking incoming sets; and arithmetic on FloatValues.
+//
+// Usage: atomspace_bench [number-of-atoms] [repetitions]
+//
+// See bench.h for the report format.
+
+#include <string>
+
+#include <opencog/atoms/base/Link.h>
+#include <opencog/atoms/base/Node.h>
+#include <opencog/atoms/value/FloatValue.h>
+#include <opencog/atomspace/AtomSpace.h>
+
+#include "bench.h"
+
+using namespace opencog;
+using bench::run;
+using bench::sink;
+
+int main(int argc, char* argv[])
+{
+	bench::init(argc, argv, 100000);
+	size_t natoms = bench::size;
+
+	std::vector<std::string> names;
+	for (size_t i = 0; i < natoms; i++)
+		names.push_back("node " + std::to_string(i));
+
+	// ------------------------------------------------------------
+	// Atoms.
+
+	run("atom/createNode", natoms, [&]() {
+		for (size_t i = 0; i < natoms; i++)
+			sink += (bool) createNode(CONCEPT_NODE, std::string(names[i]));
+	});
+
+	AtomSpacePtr as;
+	HandleSeq nodes;
+	run("atom/add_node", natoms,
+		[&]() { nodes.clear(); as = createAtomSpace(); },
+		[&]() {
+			for (size_t i = 0; i < natoms; i++)
+				nodes.push_back(as->add_node(CONCEPT_NODE,
+					std::string(names[i])));
+		});
+
+	// Each node is in the incoming set of three links: two ListLinks,
+	// and one EvaluationLink.
+	Handle pred = as->add_node(PREDICATE_NODE, "pred");
+	run("atom/add_link", natoms,
+		[&]() {
+			for (size_t i = 0; i < natoms; i++)
+			{
+				Handle h(as->get_link(LIST_LINK,
+					{nodes[i], nodes[(i+1) % natoms]}));
+				if (h) as->extract_atom(h);
+			}
+		},
+		[&]() {
+			for (size_t i = 0; i < natoms; i++)
+				sink += (bool) as->add_link(LIST_LINK,
+					{nodes[i], nodes[(i+1) % natoms]});
+		});
+
+	for (size_t i = 0; i < natoms; i++)
+		as->add_link(EVALUATION_LINK, {pred, nodes[i]});
+
+	run("atom/get_handles_by_type", natoms, [&]() {
+		HandleSeq hs;
+		as->get_handles_by_type(hs, CONCEPT_NODE);
+		sink += hs.size();
+	});
+
+	// ------------------------------------------------------------
+	// Incoming sets.
+
+	run("incoming/getIncomingSet", natoms, [&]() {
+		for (size_t i = 0; i < natoms; i++)
+			sink += nodes[i]->getIncomingSet().size();
+	});
+
+	run("incoming/getIncomingSetByType", natoms, [&]() {
+		for (size_t i = 0; i < natoms; i++)
+			sink += nodes[i]->getIncomingSetByType(EVALUATION_LINK).size();
+	});
+
+	run("incoming/getIncomingSetSize", natoms, [&]() {
+		for (size_t i = 0; i < natoms; i++)
+			sink += nodes[i]->getIncomingSetSize();
+	});
+
+	// One big hub.
+	run("incoming/hub", natoms, [&]() {
+		for (const Handle& h : pred->getIncomingSet())
+			sink += h->get_arity();
+	});
+
+	// ------------------------------------------------------------
+	// Values.
+
+	Handle key = as->add_node(PREDICATE_NODE, "key");
+	ValuePtr fv = createFloatValue(std::vector<double>({1.0, 2.0, 3.0}));
+
+	run("value/set_value", natoms, [&]() {
+		for (size_t i = 0; i < natoms; i++)
+			sink += (bool) as->set_value(nodes[i], key, fv);
+	});
+
+	run("value/getValue", natoms, [&]() {
+		for (size_t i = 0; i < natoms; i++)
+			sink += (bool) nodes[i]->getValue(key);
+	});
+
+	run("value/getKeys", natoms, [&]() {
+		for (size_t i = 0; i < natoms; i++)
+			sink += nodes[i]->getKeys().size();
+	});
+
+	run("value/increment_count", natoms, [&]() {
+		for (size_t i = 0; i < natoms; i++)
+			sink += (bool) as->increment_count(nodes[i], key, 2, 1.0);
+	});
+
+	// The same Atom, over and over: the cost without cache misses.
+	run("value/increment_count_one", natoms, [&]() {
+		for (size_t i = 0; i < natoms; i++)
+			sink += (bool) as->increment_count(nodes[0], key, 2, 1.0);
+	});
+
+	// ------------------------------------------------------------
+	// FloatValue arithmetic, on short vectors, where the cost of
+	// making a new FloatValue dominates, and on long ones.
+
+	for (size_t len : {4, 4096})
+	{
+		std::vector<double> va(len), vb(len);
+		for (size_t j = 0; j < len; j++) { va[j] = j + 1.0; vb[j] = 0.5 * j; }
+		FloatValuePtr fa = createFloatValue(va);
+		FloatValuePtr fb = createFloatValue(vb);
+
+		size_t calls = std::max<size_t>(1, natoms * 4 / len);
+		std::string sfx = "_" + std::to_string(len);
+
+		run(("float/plus" + sfx).c_str(), calls, [&]() {
+			for (size_t i = 0; i < calls; i++)
+				sink += (bool) plus(fa, fb);
+		});
+
+		run(("float/times" + sfx).c_str(), calls, [&]() {
+			for (size_t i = 0; i < calls; i++)
+				sink += (bool) times(fa, fb);
+		});
+
+		run(("float/divide" + sfx).c_str(), calls, [&]() {
+			for (size_t i = 0; i < calls; i++)
+				sink += (bool) divide(fa, fb);
+		});
+
+		run(("float/scale" + sfx).c_str(), calls, [&]() {
+			for (size_t i = 0; i < calls; i++)
+				sink += (bool) times(3.0, fa);
+		});
+	}
+
+	// The same, through Atomese.
+	Handle plus_link = as->add_link(PLUS_LINK, {
+		as->add_node(NUMBER_NODE, "1 2 3 4"),
+		as->add_node(NUMBER_NODE, "5 6 7 8")});
+	run("float/PlusLink", natoms, [&]() {
+		for (size_t i = 0; i < natoms; i++)
+			sink += (bool) plus_link->execute(as.get());
+	});
+
+	return 0;
+}
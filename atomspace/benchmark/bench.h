@@ -0,0 +1,74 @@
+//
+// benchmark/bench.h
+//
+// The timing harness shared by the benchmarks in this directory. It is
+// installed as <opencog/benchmark/bench.h>, for the benchmarks of the
+// other components, so that all of the reports have the same format.
+//
+// Each case is run several times, and the fastest run is reported, as
+// one line of three tab-separated columns: the case name, the number
+// of calls made in one run, and the mean time per call, in
+// nanoseconds. Lines starting with `#` are comments. The reports of
+// two builds can be compared with `compare.py`.
+//
+// All of the programs take the same arguments:
+//
+//     xxx_bench [size] [repetitions]
+
+#ifndef _OPENCOG_BENCH_H
+#define _OPENCOG_BENCH_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+
+namespace bench
+{
+
+// Results are added to this, so that the work isn't optimized away.
+static size_t sink = 0;
+
+static size_t size = 0;
+static size_t reps = 5;
+
+/// Read the arguments, and print the report header.
+static void init(int argc, char* argv[], size_t default_size)
+{
+	size = 1 < argc ? atol(argv[1]) : default_size;
+	reps = 2 < argc ? atol(argv[2]) : reps;
+	if (0 == reps) reps = 1;
+	printf("# %s size=%zu reps=%zu\n", argv[0], size, reps);
+	printf("# case\tcalls\tns/call\n");
+}
+
+/// Time `fn`, which makes `calls` calls of whatever is being measured.
+/// `setup` is run before each repetition, and is not timed; use it to
+/// undo whatever `fn` did.
+template<typename S, typename F>
+static void run(const char* name, size_t calls, S&& setup, F&& fn)
+{
+	double best = std::numeric_limits<double>::max();
+	for (size_t r = 0; r < reps; r++)
+	{
+		setup();
+		auto start = std::chrono::steady_clock::now();
+		fn();
+		auto end = std::chrono::steady_clock::now();
+		best = std::min(best,
+			std::chrono::duration<double, std::nano>(end - start).count());
+	}
+	printf("%s\t%zu\t%.1f\n", name, calls, best / calls);
+	fflush(stdout);
+}
+
+template<typename F>
+static void run(const char* name, size_t calls, F&& fn)
+{
+	run(name, calls, []() {}, fn);
+}
+
+} // namespace bench
+
+#endif // _OPENCOG_BENCH_H
@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+#
+# benchmark/compare.py
+#
+# Compare two benchmark reports, such as those made by the programs in
+# this directory, before and after some change, or for two releases:
+#
+#     ./atomspace_bench > before.txt
+#     ... rebuild ...
+#     ./atomspace_bench > after.txt
+#     compare.py before.txt after.txt
+#
+# Prints the cases found in both, with the ratio of the new time to
+# the old. Exits with status 1 if any case got slower by more than the
+# threshold (by default, 10%), so that this can be used in a script.
+
+import argparse
+import sys
+
+
+def read_report(path):
+    times = {}
+    with open(path) as f:
+        for line in f:
+            line = line.strip()
+            if not line or line.startswith('#'):
+                continue
+            name, calls, ns = line.split('\t')
+            times[name] = float(ns)
+    return times
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Compare two benchmark reports.')
+    parser.add_argument('old')
+    parser.add_argument('new')
+    parser.add_argument('-t', '--threshold', type=float, default=10.0,
+                        help='percent slowdown counted as a regression')
+    args = parser.parse_args()
+
+    old = read_report(args.old)
+    new = read_report(args.new)
+    limit = 1.0 + args.threshold / 100.0
+
+    regressions = 0
+    print('%-36s %12s %12s %8s' % ('case', 'old ns', 'new ns', 'ratio'))
+    for name in old:
+        if name not in new:
+            continue
+        ratio = new[name] / old[name] if 0.0 < old[name] else 1.0
+        flag = ''
+        if limit < ratio:
+            flag = '  SLOWER'
+            regressions += 1
+        elif ratio < 1.0 / limit:
+            flag = '  faster'
+        print('%-36s %12.1f %12.1f %8.3f%s' %
+              (name, old[name], new[name], ratio, flag))
+
+    for name in sorted(set(old) ^ set(new)):
+        print('%-36s only in %s' % (name, args.old if name in old else args.new))
+
+    if regressions:
+        print('%d case(s) slower by more than %g%%' %
+              (regressions, args.threshold))
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
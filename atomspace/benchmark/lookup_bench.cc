@@ -0,0 +1,87 @@
+//
+// benchmark/lookup_bench.cc
+//
+// Cost of looking up atoms that are already in the AtomSpace, which
+// is what most calls to add_node(), add_link(), get_node() and
+// get_link() end up doing. For comparison, the same lookups are also
+// made the long way around, by building a full Atom and passing that
+// to get_atom().
+//
+// Usage: lookup_bench [number-of-atoms] [repetitions]
+//
+// See bench.h for the report format.
+
+#include <string>
+
+#include <opencog/atoms/base/Link.h>
+#include <opencog/atoms/base/Node.h>
+#include <opencog/atomspace/AtomSpace.h>
+
+#include "bench.h"
+
+using namespace opencog;
+using bench::run;
+using bench::sink;
+
+int main(int argc, char* argv[])
+{
+	bench::init(argc, argv, 100000);
+	size_t natoms = bench::size;
+
+	AtomSpacePtr as = createAtomSpace();
+
+	// Names long enough that copying them costs an allocation.
+	std::vector<std::string> names;
+	HandleSeq nodes;
+	for (size_t i = 0; i < natoms; i++)
+	{
+		names.push_back("a somewhat longish node name " + std::to_string(i));
+		nodes.push_back(as->add_node(CONCEPT_NODE, std::string(names[i])));
+	}
+	for (size_t i = 0; i < natoms; i++)
+		as->add_link(LIST_LINK, {nodes[i], nodes[(i+1) % natoms]});
+
+	size_t calls = natoms;
+
+	run("lookup/add_node", calls, [&]() {
+		for (size_t i = 0; i < natoms; i++)
+			sink += (bool) as->add_node(CONCEPT_NODE, std::string(names[i]));
+	});
+
+	run("lookup/get_node", calls, [&]() {
+		for (size_t i = 0; i < natoms; i++)
+			sink += (bool) as->get_node(CONCEPT_NODE, std::string(names[i]));
+	});
+
+	run("lookup/get_atom(createNode)", calls, [&]() {
+		for (size_t i = 0; i < natoms; i++)
+			sink += (bool) as->get_atom(createNode(CONCEPT_NODE, names[i]));
+	});
+
+	run("lookup/add_link", calls, [&]() {
+		for (size_t i = 0; i < natoms; i++)
+			sink += (bool) as->add_link(LIST_LINK,
+				{nodes[i], nodes[(i+1) % natoms]});
+	});
+
+	run("lookup/get_link", calls, [&]() {
+		for (size_t i = 0; i < natoms; i++)
+			sink += (bool) as->get_link(LIST_LINK,
+				{nodes[i], nodes[(i+1) % natoms]});
+	});
+
+	run("lookup/get_atom(createLink)", calls, [&]() {
+		for (size_t i = 0; i < natoms; i++)
+			sink += (bool) as->get_atom(createLink(LIST_LINK,
+				nodes[i], nodes[(i+1) % natoms]));
+	});
+
+	// Every one of the lookups above should have been a hit.
+	size_t hits = 6 * calls * bench::reps;
+	if (sink != hits)
+	{
+		fprintf(stderr, "Error: expected %zu hits, got %zu\n", hits, sink);
+		return 1;
+	}
+	return 0;
+}
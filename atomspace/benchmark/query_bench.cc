@@ -0,0 +1,129 @@
+//
+// benchmark/query_bench.cc
+//
+// Cost of running queries of different shapes: starting from a
+// constant, joining two clauses on a variable, scanning all Links of
+// a type, matching unordered Links, and matching globs.
+//
+// Usage: query_bench [number-of-atoms] [repetitions]
+//
+// The queries are run against a graph with about ten times as many
+// Links as there are nodes. Each case runs a few hundred different
+// queries of the same shape, built before the timing starts; the
+// time reported is per query.
+//
+// See bench.h for the report format.
+
+#include <string>
+
+#include <opencog/atoms/base/Link.h>
+#include <opencog/atoms/base/Node.h>
+#include <opencog/atoms/value/ContainerValue.h>
+#include <opencog/atomspace/AtomSpace.h>
+
+#include "bench.h"
+
+using namespace opencog;
+using bench::run;
+using bench::sink;
+
+static AtomSpacePtr as;
+
+static Handle concept(size_t i)
+{
+	return as->add_node(CONCEPT_NODE, "node " + std::to_string(i));
+}
+
+static Handle var(const char* name)
+{
+	return as->add_node(VARIABLE_NODE, name);
+}
+
+static Handle query(const Handle& body, const Handle& rewrite)
+{
+	return as->add_link(QUERY_LINK, {body, rewrite});
+}
+
+/// Run all of the queries once each, and count the results.
+static void run_queries(const char* name, const HandleSeq& queries)
+{
+	run(name, queries.size(), [&]() {
+		for (const Handle& q : queries)
+		{
+			ValuePtr vp(q->execute(as.get()));
+			sink += ContainerValueCast(vp)->size();
+		}
+	});
+}
+
+int main(int argc, char* argv[])
+{
+	bench::init(argc, argv, 10000);
+	size_t natoms = bench::size;
+	size_t nqueries = std::min<size_t>(natoms, 200);
+
+	as = createAtomSpace();
+
+	// Each node inherits from three others, and is similar to one;
+	// there are some evaluations over pairs of them, and some
+	// sentences made of them.
+	Handle likes = as->add_node(PREDICATE_NODE, "likes");
+	for (size_t i = 0; i < natoms; i++)
+	{
+		Handle ci = concept(i);
+		for (size_t d : {1, 7, 31})
+			as->add_link(INHERITANCE_LINK, {ci, concept((i + d) % natoms)});
+		as->add_link(SIMILARITY_LINK, {ci, concept((i * 13 + 5) % natoms)});
+		as->add_link(EVALUATION_LINK, {likes,
+			as->add_link(LIST_LINK, {ci, concept((i * 17 + 3) % natoms)})});
+		as->add_link(LIST_LINK, {concept(i % 100), ci,
+			concept((i + 1) % natoms), concept((i + 2) % natoms)});
+	}
+
+	Handle x = var("$x"), y = var("$y");
+	Handle glob = as->add_node(GLOB_NODE, "$g");
+
+	HandleSeq anchored, joined, unordered, globbed;
+	for (size_t i = 0; i < nqueries; i++)
+	{
+		size_t k = (i * 7919) % natoms;
+
+		// (Inheritance (Concept k) $x)
+		anchored.push_back(query(
+			as->add_link(INHERITANCE_LINK, {concept(k), x}), x));
+
+		// (Inheritance (Concept k) $x) (Inheritance $x $y)
+		joined.push_back(query(as->add_link(AND_LINK, {
+				as->add_link(INHERITANCE_LINK, {concept(k), x}),
+				as->add_link(INHERITANCE_LINK, {x, y})}),
+			as->add_link(LIST_LINK, {x, y})));
+
+		// (Similarity (Concept k) $x)
+		unordered.push_back(query(
+			as->add_link(SIMILARITY_LINK, {concept(k), x}), x));
+
+		// (List (Concept k%100) $g)
+		globbed.push_back(query(
+			as->add_link(LIST_LINK, {concept(k % 100), glob}), glob));
+	}
+
+	run_queries("query/anchored", anchored);
+	run_queries("query/join", joined);
+	run_queries("query/unordered", unordered);
+	run_queries("query/glob", globbed);
+
+	// All of the EvaluationLinks; there is no constant to start from,
+	// other than the predicate, which is a hub.
+	HandleSeq scan({query(as->add_link(EVALUATION_LINK, {likes,
+		as->add_link(LIST_LINK, {x, y})}), as->add_link(LIST_LINK, {x, y}))});
+	run_queries("query/scan", scan);
+
+	// No constants at all: every InheritanceLink is a candidate.
+	HandleSeq untyped({query(as->add_link(AND_LINK, {
+			as->add_link(INHERITANCE_LINK, {x, y}),
+			as->add_link(INHERITANCE_LINK, {y, x})}),
+		as->add_link(LIST_LINK, {x, y}))});
+	run_queries("query/no_constants", untyped);
+
+	return 0;
+}
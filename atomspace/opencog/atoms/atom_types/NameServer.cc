@@ -29,6 +29,7 @@
 
 #include "NameServer.h"
 
+#include <algorithm>
 #include <exception>
 
 #include <opencog/atoms/atom_types/types.h>
@@ -44,6 +45,7 @@
 using namespace opencog;
 
 NameServer::NameServer(void)
+	: _frozen(nullptr), _thawed(true)
 {
 	nTypes = MAX_NUM_VALUE + 1;
 	nValues = 0;   // TopType is 0  Value is 1
@@ -87,6 +89,10 @@ bool NameServer::beginTypeDecls(const char * mod_name)
 
 	_tmod++;
 	_loaded_modules.insert(mname);
+
+	// Until these declarations are done, the frozen copy of the
+	// type tables is out of date.
+	_thawed.store(true, std::memory_order_seq_cst);
 	return false;
 }
 
@@ -94,6 +100,7 @@ void NameServer::endTypeDecls(void)
 {
 	// Valid types are odd-numbered.
 	_tmod++;
+	freeze();
 	_module_mutex.unlock();
 
 	classserver().update_factories();
@@ -225,26 +232,170 @@ TypeSignal& NameServer::typeAddedSignal()
     return _addTypeSignal;
 }
 
+/* ================================================================ */
+
+/// The finalizer of splitmix64; scrambles the bits of the name hash.
+static inline uint64_t mix(uint64_t x)
+{
+	x ^= x >> 30;
+	x *= 0xbf58476d1ce4e5b9ULL;
+	x ^= x >> 27;
+	x *= 0x94d049bb133111ebULL;
+	x ^= x >> 31;
+	return x;
+}
+
+static inline uint64_t name_hash(const std::string& name)
+{
+	return mix(std::hash<std::string>{}(name));
+}
+
+static inline uint64_t name_slot(uint64_t h, uint32_t displacement)
+{
+	return mix(h + displacement * 0x9e3779b97f4a7c15ULL);
+}
+
+Type NameServer::Frozen::lookup(const std::string& name) const
+{
+	uint64_t h = name_hash(name);
+	uint32_t d = displace[h & bucket_mask];
+	const auto& slot = slots[name_slot(h, d) & slot_mask];
+	if (slot.first and *slot.first == name) return slot.second;
+	return NOTYPE;
+}
+
+/**
+ * Build a new frozen copy of the type tables, and publish it.
+ *
+ * The name table is a perfect hash, built with the hash-and-displace
+ * method: the names are first hashed into buckets, averaging two
+ * names each. Then, the largest buckets first, each bucket is given
+ * the smallest displacement that puts all of its names into slots
+ * not yet taken. With twice as many slots as names, a displacement
+ * is found after a few tries. A lookup is then one string hash, two
+ * array reads and one string compare, never more.
+ */
+void NameServer::freeze()
+{
+	std::lock_guard<std::mutex> l(type_mutex);
+
+	std::unique_ptr<Frozen> f(new Frozen());
+	f->nTypes = nTypes;
+	f->nValues = nValues;
+	f->words = (nTypes + 63) / 64;
+	f->ancestry.assign(nTypes * f->words, 0);
+	for (Type super = 0; super < nTypes; super++)
+		for (Type sub = 0; sub < nTypes; sub++)
+			if (super < recursiveMap.size() and
+			    sub < recursiveMap[super].size() and
+			    recursiveMap[super][sub])
+				f->ancestry[super * f->words + (sub >> 6)] |= 1ULL << (sub & 63);
+
+	f->code2name = _code2NameMap;
+	f->code2short = _code2ShortMap;
+
+	size_t nnames = name2CodeMap.size();
+	size_t nslots = 2;
+	while (nslots < 2 * nnames) nslots <<= 1;
+	size_t nbuckets = 1;
+	while (2 * nbuckets < nnames) nbuckets <<= 1;
+
+	typedef std::pair<const std::string*, Type> Entry;
+	while (true)
+	{
+		std::vector<std::vector<std::pair<uint64_t, Entry>>> buckets(nbuckets);
+		for (const auto& pr : name2CodeMap)
+		{
+			uint64_t h = name_hash(pr.first);
+			buckets[h & (nbuckets - 1)].push_back({h, {&pr.first, pr.second}});
+		}
+
+		std::vector<size_t> order(nbuckets);
+		for (size_t b = 0; b < nbuckets; b++) order[b] = b;
+		std::sort(order.begin(), order.end(), [&](size_t a, size_t b)
+			{ return buckets[a].size() > buckets[b].size(); });
+
+		f->displace.assign(nbuckets, 0);
+		f->slots.assign(nslots, Entry(nullptr, NOTYPE));
+		std::vector<size_t> taken;
+		bool ok = true;
+		for (size_t b : order)
+		{
+			if (buckets[b].empty()) break;
+			uint32_t d = 0;
+			for (; d < 4096; d++)
+			{
+				taken.clear();
+				for (const auto& he : buckets[b])
+				{
+					size_t s = name_slot(he.first, d) & (nslots - 1);
+					if (f->slots[s].first or
+					    std::find(taken.begin(), taken.end(), s) != taken.end())
+						break;
+					taken.push_back(s);
+				}
+				if (taken.size() == buckets[b].size()) break;
+			}
+			if (4096 == d) { ok = false; break; }
+
+			f->displace[b] = d;
+			for (size_t i = 0; i < taken.size(); i++)
+				f->slots[taken[i]] = buckets[b][i].second;
+		}
+		if (ok) break;
+
+		// Very unlikely; try again with more room.
+		nslots <<= 1;
+	}
+	f->bucket_mask = nbuckets - 1;
+	f->slot_mask = nslots - 1;
+
+	_frozen.store(f.get(), std::memory_order_release);
+	_all_frozen.emplace_back(std::move(f));
+	_thawed.store(false, std::memory_order_release);
+}
+
+/* ================================================================ */
+
+bool NameServer::isA_locked(Type sub, Type super) const
+{
+	std::lock_guard<std::mutex> l(type_mutex);
+	if ((sub >= nTypes) || (super >= nTypes)) return false;
+	return recursiveMap[super][sub];
+}
+
 bool NameServer::isAncestor(Type super, Type sub) const
 {
+	const Frozen* f = frozen();
+	if (f) return f->isA(sub, super);
+
 	std::lock_guard<std::mutex> l(type_mutex);
 	return recursiveMap[super][sub];
 }
 
 bool NameServer::isDefined(const std::string& typeName) const
 {
+    const Frozen* f = frozen();
+    if (f) return NOTYPE != f->lookup(typeName);
+
     std::lock_guard<std::mutex> l(type_mutex);
     return name2CodeMap.find(typeName) != name2CodeMap.end();
 }
 
 bool NameServer::isDefined(Type t) const
 {
+    const Frozen* f = frozen();
+    if (f) return (1 <= t and t < f->nValues) or (ATOM <= t and t < f->nTypes);
+
     std::lock_guard<std::mutex> l(type_mutex);
     return (1 <= t and t < nValues) or (ATOM <= t and t < nTypes);
 }
 
 Type NameServer::getType(const std::string& typeName) const
 {
+    const Frozen* f = frozen();
+    if (f) return f->lookup(typeName);
+
     std::lock_guard<std::mutex> l(type_mutex);
     std::unordered_map<std::string, Type>::const_iterator it = name2CodeMap.find(typeName);
     if (it == name2CodeMap.end()) {
@@ -259,8 +410,17 @@ const std::string& NameServer::getTypeName(Type type) const
     static std::string bottomString = "*** Bottom Type! ***";
 
     if (NOTYPE == type) return bottomString;
-    if (nTypes <= type) return nullString;
 
+    const Frozen* f = frozen();
+    if (f)
+    {
+        if (f->nTypes <= type) return nullString;
+        const std::string* name = f->code2name[type];
+        if (name) return *name;
+        return nullString;
+    }
+
+    if (nTypes <= type) return nullString;
     std::lock_guard<std::mutex> l(type_mutex);
     const std::string* name = _code2NameMap[type];
     if (name) return *name;
@@ -273,8 +433,17 @@ const std::string& NameServer::getTypeShortName(Type type) const
     static std::string bottomString = "*** Bottom Type! ***";
 
     if (NOTYPE == type) return bottomString;
-    if (nTypes <= type) return nullString;
 
+    const Frozen* f = frozen();
+    if (f)
+    {
+        if (f->nTypes <= type) return nullString;
+        const std::string* name = f->code2short[type];
+        if (name) return *name;
+        return nullString;
+    }
+
+    if (nTypes <= type) return nullString;
     std::lock_guard<std::mutex> l(type_mutex);
     const std::string* name = _code2ShortMap[type];
     if (name) return *name;
@@ -24,6 +24,9 @@
 #ifndef _OPENCOG_CLASS_NAMESERVER_H
 #define _OPENCOG_CLASS_NAMESERVER_H
 
+#include <atomic>
+#include <cstdint>
+#include <memory>
 #include <mutex>
 #include <set>
 #include <string>
@@ -88,6 +91,63 @@ private:
 
     void setParentRecursively(Type parent, Type type, Type& maxd);
 
+    /* A frozen, immutable copy of the type hierarchy and the type
+     * names, so that lookups need not take the type_mutex. A new one
+     * is built and published at the end of each batch of type
+     * declarations; while a batch is in progress, lookups fall back
+     * to the locked tables above. This is read-copy-update, without
+     * the reclamation: old copies are kept until the NameServer goes
+     * away, as some reader might still be looking at them. Type
+     * declarations come in a few dozen batches, at most, so this is
+     * cheap.
+     */
+    struct Frozen
+    {
+        Type nTypes;
+        Type nValues;
+
+        // The recursive inheritance relation, as a flat bit matrix:
+        // bit `sub` of row `super` is set if sub isA super.
+        size_t words;
+        std::vector<uint64_t> ancestry;
+
+        // All of the long and short names, in a perfect hash table.
+        // The name hash picks a bucket; the bucket holds the
+        // displacement that sends each of its names to a slot of its
+        // own. See NameServer::freeze().
+        uint64_t bucket_mask;
+        uint64_t slot_mask;
+        std::vector<uint32_t> displace;
+        std::vector<std::pair<const std::string*, Type>> slots;
+
+        std::vector<const std::string*> code2name;
+        std::vector<const std::string*> code2short;
+
+        bool isA(Type sub, Type super) const
+        {
+            if ((sub >= nTypes) || (super >= nTypes)) return false;
+            return (ancestry[super * words + (sub >> 6)] >> (sub & 63)) & 1;
+        }
+
+        Type lookup(const std::string&) const;
+    };
+
+    std::atomic<const Frozen*> _frozen;
+    std::atomic<bool> _thawed;
+    std::vector<std::unique_ptr<const Frozen>> _all_frozen;
+
+    void freeze();
+
+    /* The current frozen copy, or null if types are being declared
+     * right now, and the copy may be out of date. */
+    const Frozen* frozen() const
+    {
+        if (_thawed.load(std::memory_order_acquire)) return nullptr;
+        return _frozen.load(std::memory_order_acquire);
+    }
+
+    bool isA_locked(Type sub, Type super) const;
+
 public:
     /** Gets the singleton instance (following meyer's design pattern) */
     friend NameServer& nameserver();
@@ -157,7 +217,7 @@ public:
     {
         unsigned long n_children = 0;
         for (Type i = type+1; i < nTypes; ++i) {
-            if (recursiveMap[type][i]) {
+            if (isA(i, type)) {
                 *(result++) = i;
                 n_children++;
             }
@@ -168,7 +228,7 @@ public:
     {
         TypeSet ts;
         for (Type i = type+1; i < nTypes; ++i) {
-            if (recursiveMap[type][i]) {
+            if (isA(i, type)) {
                 ts.insert(i);
             }
         }
@@ -186,7 +246,7 @@ public:
     {
         unsigned long n_parents = 0;
         for (Type i = 0; i < type; ++i) {
-            if (recursiveMap[i][type]) {
+            if (isA(type, i)) {
                 *(result++) = i;
                 n_parents++;
             }
@@ -197,7 +257,7 @@ public:
     {
         TypeSet ts;
         for (Type i = 0; i < type; ++i) {
-            if (recursiveMap[i][type]) {
+            if (isA(type, i)) {
                 ts.insert(i);
             }
         }
@@ -208,7 +268,7 @@ public:
     void foreachRecursive(Function func, Type type) const
     {
         for (Type i = 0; i < nTypes; ++i) {
-            if (recursiveMap[type][i]) (func)(i);
+            if (isA(i, type)) (func)(i);
         }
     }
 
@@ -230,25 +290,13 @@ public:
     bool isA(Type sub, Type super) const
     {
         /* Because this method is called extremely often, we want
-         * the best-case fast-path for it.  Since updates are extremely
-         * unlikely after initialization, we use a multi-reader lock,
-         * and don't care at all about writer starvation, since there
-         * will almost never be writers. However, see comments above
-         * about multi-reader-locks -- we are not using them just right
-         * now, because they don't seem to actually help.
-         *
-         * Currently, this lock accounts for 2% or 3% performance
-         * impact on atom insertion into atomspace.  The unit tests
-         * don't need it to pass.  Most users probably dont need it
-         * at all, because most type creation/update happens in
-         * shared-lib ctors, which mostly should be done by the time
-         * that this gets called. How big a price do you want to pay
-         * for avoiding a possible crash on a shared-lib load while
-         * also running some multi-threaded app?
+         * the best-case fast-path for it: a lookup in the frozen
+         * copy of the type hierarchy, without any lock. Only while
+         * new types are being declared does this take the lock.
          */
-        // std::lock_guard<std::mutex> l(type_mutex);
-        if ((sub >= nTypes) || (super >= nTypes)) return false;
-        return recursiveMap[super][sub];
+        const Frozen* f = frozen();
+        if (f) return f->isA(sub, super);
+        return isA_locked(sub, super);
     }
 
     bool isAncestor(Type super, Type sub) const;
@@ -35,6 +35,7 @@
 #include <opencog/atoms/base/Atom.h>
 #include <opencog/atoms/base/Link.h>
 #include <opencog/atoms/base/Node.h>
+#include <opencog/atoms/base/ValueReadLog.h>
 #include <opencog/atoms/truthvalue/CountTruthValue.h>
 #include <opencog/atoms/value/FloatValue.h>
 
@@ -73,6 +74,10 @@ static const Handle& truth_key(void)
 	return tk;
 }
 
+/// Tell change-feed subscribers, if any, that a Value has changed.
+#define VALUE_CHANGED(KEY,VAL) \
+	if (_atom_space) _atom_space->value_changed(this, KEY, VAL);
+
 void Atom::setTruthValue(const TruthValuePtr& newTV)
 {
     if (nullptr == newTV) return;
@@ -125,6 +130,7 @@ TruthValuePtr Atom::incrementCountTV(double cnt)
 	TruthValuePtr newTV = CountTruthValue::createTV(mean, conf, cnt);
 
 	_values[truth_key()] = ValueCast(newTV);
+	VALUE_CHANGED(truth_key(), ValueCast(newTV));
 	return newTV;
 }
 
@@ -143,6 +149,7 @@ void Atom::setValue(const Handle& key, const ValuePtr& value)
 			_values[truth_key()] = value;
 		else
 			_values.erase(truth_key());
+		VALUE_CHANGED(truth_key(), value);
 	}
 	else
 	{
@@ -151,6 +158,7 @@ void Atom::setValue(const Handle& key, const ValuePtr& value)
 			_values[key] = value;
 		else
 			_values.erase(key);
+		VALUE_CHANGED(key, value);
 	}
 }
 
@@ -170,20 +178,25 @@ ValuePtr Atom::getValue(const Handle& key) const
     // This is rather irritating, but we fake it for the
     // PredicateNode "*-TruthValueKey-*" because if we don't
     // then load-from-file and load-from-network breaks.
+    ValuePtr vp;
     if ((key != truth_key()) and (*key == *truth_key()))
     {
         KVP_SHARED_LOCK;
         auto pr = _values.find(truth_key());
-        if (_values.end() != pr) return pr->second;
+        if (_values.end() != pr) vp = pr->second;
     }
     else
     {
         KVP_SHARED_LOCK;
         auto pr = _values.find(key);
-        if (_values.end() != pr) return pr->second;
+        if (_values.end() != pr) vp = pr->second;
     }
 
-    return ValuePtr();
+    // Someone wants to know what values they depend on.
+    if (ValueReadLog::recording())
+        ValueReadLog::note(this, key, vp);
+
+    return vp;
 }
 
 ValuePtr Atom::incrementCount(const Handle& key, const std::vector<double>& count)
@@ -216,6 +229,7 @@ ValuePtr Atom::incrementCount(const Handle& key, const std::vector<double>& coun
 		ValuePtr nv = fv->incrementCount(count);
 
 		_values[key] = nv;
+		VALUE_CHANGED(key, nv);
 		return nv;
 	}
 
@@ -232,6 +246,7 @@ ValuePtr Atom::incrementCount(const Handle& key, const std::vector<double>& coun
 		nv = createFloatValue(FLOAT_VALUE, count);
 
 	_values[key] = nv;
+	VALUE_CHANGED(key, nv);
 	return nv;
 }
 
@@ -266,6 +281,7 @@ ValuePtr Atom::incrementCount(const Handle& key, size_t idx, double count)
 		ValuePtr nv = fv->incrementCount(idx, count);
 
 		_values[key] = nv;
+		VALUE_CHANGED(key, nv);
 		return nv;
 	}
 
@@ -286,6 +302,7 @@ ValuePtr Atom::incrementCount(const Handle& key, size_t idx, double count)
 		nv = createFloatValue(FLOAT_VALUE, new_vect);
 
 	_values[key] = nv;
+	VALUE_CHANGED(key, nv);
 	return nv;
 }
 
@@ -210,6 +210,9 @@ typedef std::set<WinkPtr, std::owner_less<WinkPtr> > WincomingSet;
  * A "typical" Link of size 2, held in one other Link, in AtomSpace, holding
  *   a CountTV in it: 496 Bytes.  This is indeed what is measured in real-life
  *   large datasets.
+ *
+ * To get the numbers for a live AtomSpace, broken down by type and by
+ * Value key, use AtomSpace::get_memory_usage().
  */
 class Atom
     : public Value
@@ -160,6 +160,11 @@ ClassServer::Validator* ClassServer::getValidator(Type t) const
 	return t < _validator.size() ? _validator[t] : nullptr;
 }
 
+bool ClassServer::isPlain(Type t) const
+{
+	return nullptr == getFactory(t) and nullptr == getValidator(t);
+}
+
 Handle ClassServer::factory(const Handle& h) const
 {
 	Handle result;
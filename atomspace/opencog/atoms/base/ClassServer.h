@@ -104,6 +104,12 @@ public:
     void addValidator(Type, Validator*);
     Validator* getValidator(Type) const;
 
+    /**
+     * Return true if atoms of this type are used just as constructed:
+     * there is neither a factory nor a validator for them.
+     */
+    bool isPlain(Type) const;
+
     /**
      * Convert the indicated Atom into a C++ instance of the
      * same type.
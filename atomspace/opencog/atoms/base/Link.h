@@ -125,6 +125,11 @@ public:
         return _outgoing.size();
     }
 
+    // The Atom and its outgoing set, but not the Atoms in it.
+    virtual size_t footprint() const {
+        return sizeof(Link) + _outgoing.capacity() * sizeof(Handle);
+    }
+
     /**
      * Returns a const reference to the array containing this
      * atom's outgoing set.
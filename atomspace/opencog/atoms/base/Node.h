@@ -56,7 +56,7 @@ public:
      * @param Node name A reference to a std::string with the name of
      *                  the node.  Use empty string for unnamed node.
      */
-    Node(Type t, const std::string s)
+    Node(Type t, std::string s)
         : Atom(t), _name(std::move(s))
     {
         init();
@@ -76,6 +76,17 @@ public:
     virtual const std::string& get_name() const { return _name; }
 
     virtual size_t size() const { return 1; }
+
+    // The Atom and its name; the Values and the incoming set are
+    // counted by AtomSpace::get_memory_usage().
+    virtual size_t footprint() const {
+        // Short names are stored inside the std::string itself.
+        const char* p = _name.data();
+        const char* s = (const char*) &_name;
+        if (p < s or s + sizeof(std::string) <= p)
+            return sizeof(Node) + _name.capacity() + 1;
+        return sizeof(Node);
+    }
     virtual ValuePtr value_at_index(size_t idx) const {
         return ValueCast(get_handle());
     }
@@ -0,0 +1,89 @@
+/*
+ * opencog/atoms/base/ValueReadLog.cc
+ *
+ * Copyright (C) 2026 OpenCog Foundation
+ * All Rights Reserved
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License v3 as
+ * published by the Free Software Foundation and including the exceptions
+ * at http://opencog.org/wiki/Licenses
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program; if not, write to:
+ * Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <exception>
+
+#include <opencog/atoms/atom_types/atom_types.h>
+#include <opencog/atoms/base/Atom.h>
+#include <opencog/atoms/base/ValueReadLog.h>
+
+using namespace opencog;
+
+thread_local ValueReadLog* ValueReadLog::_active = nullptr;
+
+ValueReadLog::Recorder::Recorder(ValueReadLog& log)
+    : _log(log), _outer(_active)
+{
+    _log.clear();
+    _active = &_log;
+}
+
+ValueReadLog::Recorder::~Recorder()
+{
+    _active = _outer;
+
+    if (_outer)
+    {
+        _outer->_reads.insert(_outer->_reads.end(),
+                              _log._reads.begin(), _log._reads.end());
+        _outer->_volatile = _outer->_volatile or _log._volatile;
+    }
+
+    if (std::uncaught_exceptions()) return;
+    _log._stamp = std::chrono::steady_clock::now();
+    _log._valid = true;
+}
+
+void ValueReadLog::note(const Atom* atom, const Handle& key,
+                        const ValuePtr& value)
+{
+    ValueReadLog* log = _active;
+    if (value and value->is_mutable())
+        log->_volatile = true;
+    log->_reads.push_back({atom->get_handle(), key, value});
+}
+
+void ValueReadLog::clear(void)
+{
+    _reads.clear();
+    _volatile = false;
+    _valid = false;
+}
+
+bool ValueReadLog::stale(double max_age) const
+{
+    if (not _valid or _volatile) return true;
+
+    if (0.0 < max_age)
+    {
+        std::chrono::duration<double> age =
+            std::chrono::steady_clock::now() - _stamp;
+        if (max_age <= age.count()) return true;
+    }
+
+    // Looking again is itself a read; if some outer computation is
+    // being logged, it picks these up, and so depends on them too.
+    for (const Read& r : _reads)
+        if (r.atom->getValue(r.key) != r.value) return true;
+
+    return false;
+}
@@ -0,0 +1,108 @@
+/*
+ * opencog/atoms/base/ValueReadLog.h
+ *
+ * Copyright (C) 2026 OpenCog Foundation
+ * All Rights Reserved
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License v3 as
+ * published by the Free Software Foundation and including the exceptions
+ * at http://opencog.org/wiki/Licenses
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program; if not, write to:
+ * Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#ifndef _OPENCOG_VALUE_READ_LOG_H
+#define _OPENCOG_VALUE_READ_LOG_H
+
+#include <chrono>
+#include <vector>
+
+#include <opencog/atoms/base/Handle.h>
+#include <opencog/atoms/value/Value.h>
+
+namespace opencog
+{
+
+/** \addtogroup grp_atomspace
+ *  @{
+ */
+
+/**
+ * A log of the (atom, key) values that some computation read, so that
+ * the result of the computation can be kept until one of them changes.
+ *
+ * The reads are logged by Atom::getValue(), while a Recorder is in
+ * scope on the same thread. Recorders nest: when an inner one goes out
+ * of scope, its reads are passed on to the outer one, as the outer
+ * computation depends on them too.
+ *
+ * A value counts as changed when the atom now holds a different
+ * ValuePtr under that key; setValue() and incrementCount() always
+ * install a new one. Mutable values (streams, series) are the exception,
+ * as they change without being replaced; a computation that read one
+ * is always stale. See Value::is_mutable().
+ * Nothing but values is tracked; a computation that depends on other
+ * things (the contents of the AtomSpace, grounded functions, the
+ * clock) should also give a maximum age.
+ */
+class ValueReadLog
+{
+public:
+    ValueReadLog() : _volatile(false), _valid(false) {}
+
+    /// Logs the reads made by this thread, for as long as it is in
+    /// scope. The log is cleared when it starts; it becomes valid when
+    /// the Recorder goes out of scope, unless by way of an exception.
+    class Recorder
+    {
+        ValueReadLog& _log;
+        ValueReadLog* _outer;
+    public:
+        Recorder(ValueReadLog&);
+        ~Recorder();
+        Recorder(const Recorder&) = delete;
+        Recorder& operator=(const Recorder&) = delete;
+    };
+
+    /// Return true if the computation must be run again: it never
+    /// ran, or failed, or read a value that has since changed, or ran
+    /// more than max_age seconds ago. A max_age of zero means forever.
+    bool stale(double max_age = 0.0) const;
+
+    /// Forget everything; the next stale() is true.
+    void clear(void);
+
+    size_t size(void) const { return _reads.size(); }
+
+    /// Called by Atom::getValue().
+    static inline bool recording(void) { return nullptr != _active; }
+    static void note(const Atom*, const Handle& key, const ValuePtr&);
+
+private:
+    struct Read
+    {
+        Handle atom;
+        Handle key;
+        ValuePtr value;
+    };
+    std::vector<Read> _reads;
+    bool _volatile;
+    bool _valid;
+    std::chrono::steady_clock::time_point _stamp;
+
+    static thread_local ValueReadLog* _active;
+};
+
+/** @}*/
+} // namespace opencog
+
+#endif // _OPENCOG_VALUE_READ_LOG_H
@@ -0,0 +1,171 @@
+/*
+ * ClusterColumn.cc
+ *
+ * Copyright (C) 2026 OpenCog Foundation
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License v3 as
+ * published by the Free Software Foundation and including the
+ * exceptions at http://opencog.org/wiki/Licenses
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with this program; if not, write to:
+ * Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <opencog/util/column_cluster.h>
+#include <opencog/atoms/core/FunctionLink.h>
+#include <opencog/atoms/core/NumberNode.h>
+#include <opencog/atoms/value/FloatValue.h>
+#include <opencog/atoms/value/LinkValue.h>
+#include <opencog/atomspace/AtomSpace.h>
+
+#include "ClusterColumn.h"
+
+using namespace opencog;
+
+ClusterColumn::ClusterColumn(const HandleSeq&& oset, Type t)
+	: Link(std::move(oset), t)
+{
+	if (not nameserver().isA(t, CLUSTER_COLUMN))
+	{
+		const std::string& tname = nameserver().getTypeName(t);
+		throw InvalidParamException(TRACE_INFO,
+			"Expecting a ClusterColumn, got %s", tname.c_str());
+	}
+
+	if (2 != _outgoing.size() and 4 != _outgoing.size())
+		throw InvalidParamException(TRACE_INFO,
+			"Expecting two or four arguments, got %lu", _outgoing.size());
+
+	if (not _outgoing[1]->is_type(NUMBER_NODE))
+		throw InvalidParamException(TRACE_INFO,
+			"Expecting the number of clusters, got %s",
+			_outgoing[1]->to_string().c_str());
+}
+
+// ---------------------------------------------------------------
+
+/// Point at the doubles in one column, and keep the column alive.
+static void add_column(const ValuePtr& vp, ValueSeq& keep,
+                       std::vector<const double*>& cols, size_t& nrows)
+{
+	const std::vector<double>* vals;
+	if (vp->is_type(FLOAT_VALUE))
+		vals = &FloatValueCast(vp)->value();
+	else if (vp->is_type(NUMBER_NODE))
+		vals = &NumberNodeCast(vp)->value();
+	else
+		throw RuntimeException(TRACE_INFO,
+			"Expecting a column of numbers, got %s\n", vp->to_string().c_str());
+
+	if (cols.empty())
+		nrows = vals->size();
+	else if (vals->size() != nrows)
+		throw RuntimeException(TRACE_INFO,
+			"Columns differ in length! Got %lu want %lu\n",
+			vals->size(), nrows);
+
+	keep.push_back(vp);
+	cols.push_back(vals->data());
+}
+
+/// Get the columns from the first argument. The returned Values own
+/// the doubles that `cols` points into.
+ValueSeq ClusterColumn::get_columns(AtomSpace* as, bool silent,
+                                    std::vector<const double*>& cols,
+                                    size_t& nrows)
+{
+	ValuePtr vp(FunctionLink::get_value(as, silent, _outgoing[0]));
+
+	ValueSeq keep;
+	if (vp->is_type(LINK_VALUE))
+	{
+		for (const ValuePtr& v : LinkValueCast(vp)->value())
+			add_column(FunctionLink::get_value(as, silent, v),
+			           keep, cols, nrows);
+	}
+	else if (vp->is_link())
+	{
+		for (const Handle& h : HandleCast(vp)->getOutgoingSet())
+			add_column(FunctionLink::get_value(as, silent, h),
+			           keep, cols, nrows);
+	}
+	else
+		add_column(vp, keep, cols, nrows);
+
+	return keep;
+}
+
+/// Get the Atoms that the cluster ids are to be placed on.
+HandleSeq ClusterColumn::get_rows(AtomSpace* as, bool silent)
+{
+	Handle base(_outgoing[2]);
+	if (base->is_executable())
+	{
+		ValuePtr vp(base->execute(as, silent));
+		if (vp->is_type(LINK_VALUE))
+			return LinkValueCast(vp)->to_handle_seq();
+		if (not vp->is_link())
+			throw RuntimeException(TRACE_INFO,
+				"Expecting a list of Atoms, got %s\n", vp->to_string().c_str());
+		base = HandleCast(vp);
+	}
+	return base->getOutgoingSet();
+}
+
+// ---------------------------------------------------------------
+
+/// Return a FloatValue holding the cluster ids.
+ValuePtr ClusterColumn::execute(AtomSpace* as, bool silent)
+{
+	const std::vector<double>& parms = NumberNodeCast(_outgoing[1])->value();
+	unsigned k = (unsigned) parms[0];
+	unsigned npass = (1 < parms.size()) ? (unsigned) parms[1] : 1;
+	if (0 == k)
+		throw RuntimeException(TRACE_INFO, "Need at least one cluster\n");
+
+	std::vector<const double*> cols;
+	size_t nrows = 0;
+	ValueSeq keep(get_columns(as, silent, cols, nrows));
+
+	HandleSeq rows;
+	if (4 == _outgoing.size())
+	{
+		rows = get_rows(as, silent);
+		if (rows.size() != nrows)
+			throw RuntimeException(TRACE_INFO,
+				"Got %lu Atoms for %lu rows\n", rows.size(), nrows);
+	}
+
+	std::vector<int> ids;
+	if (0 < nrows and k < nrows)
+	{
+		if (TREE_CLUSTER_COLUMN == get_type())
+			ids = tree_cluster(cols, nrows, k, 'a');
+		else
+			ids = kmeans_cluster(cols, nrows, k, npass);
+	}
+	else
+	{
+		// Every row in a cluster of its own.
+		for (size_t i = 0; i < nrows; i++)
+			ids.push_back(i);
+	}
+
+	std::vector<double> dids(ids.begin(), ids.end());
+	for (size_t i = 0; i < rows.size(); i++)
+		as->set_value(rows[i], _outgoing[3], createFloatValue(dids[i]));
+
+	return createFloatValue(std::move(dids));
+}
+
+DEFINE_LINK_FACTORY(ClusterColumn, CLUSTER_COLUMN)
+
+/* ===================== END OF FILE ===================== */
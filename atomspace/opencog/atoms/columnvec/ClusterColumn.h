@@ -0,0 +1,96 @@
+/*
+ * opencog/atoms/columnvec/ClusterColumn.h
+ *
+ * Copyright (C) 2026 OpenCog Foundation
+ * All Rights Reserved
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License v3 as
+ * published by the Free Software Foundation and including the exceptions
+ * at http://opencog.org/wiki/Licenses
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program; if not, write to:
+ * Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#ifndef _OPENCOG_CLUSTER_COLUMN_H
+#define _OPENCOG_CLUSTER_COLUMN_H
+
+#include <opencog/atoms/base/Link.h>
+
+namespace opencog
+{
+/** \addtogroup grp_atomspace
+ *  @{
+ */
+
+/// The ClusterColumn clusters the rows of a table of floats, given
+/// as columns, and returns a FloatValue holding the cluster id of
+/// each row.
+///
+/// For example,
+///
+///     ClusterColumn
+///         TransposeColumn
+///             List
+///                 Number 0 0
+///                 Number 9 9
+///                 Number 0 1
+///         Number 2
+///
+/// will return (FloatValue 0 1 0), or (FloatValue 1 0 1): two
+/// clusters, the first and last rows in one, the middle row in the
+/// other.
+///
+/// The first argument must provide the columns: a LinkValue or Link
+/// of FloatValues or NumberNodes, all of the same length, or a single
+/// one of these. Typically, this is a TransposeColumn or FloatColumn.
+/// The columns are read in place.
+///
+/// The second argument is a NumberNode holding the number of clusters,
+/// and optionally, the number of times to repeat k-means from a
+/// different random start, keeping the best. If there are no more
+/// rows than clusters, each row gets a cluster of its own.
+///
+/// If there are two more arguments, they are a list of Atoms, one per
+/// row, and a key; the cluster id of each row is also placed on the
+/// corresponding Atom, as a FloatValue at that key. The list is a Link,
+/// or something that executes to a LinkValue, typically a LinkColumn.
+///
+/// ClusterColumn clusters with k-means; TreeClusterColumn with average
+/// linkage hierarchical clustering, which needs memory quadratic in the
+/// number of rows. Both use all CPU cores.
+class ClusterColumn : public Link
+{
+protected:
+	ValueSeq get_columns(AtomSpace*, bool, std::vector<const double*>&,
+	                     size_t&);
+	HandleSeq get_rows(AtomSpace*, bool);
+
+public:
+	ClusterColumn(const HandleSeq&&, Type = CLUSTER_COLUMN);
+	ClusterColumn(const ClusterColumn&) = delete;
+	ClusterColumn& operator=(const ClusterColumn&) = delete;
+
+	virtual bool is_executable() const { return true; }
+
+	// Return a pointer to FloatValue holding the cluster ids.
+	virtual ValuePtr execute(AtomSpace*, bool);
+
+	static Handle factory(const Handle&);
+};
+
+LINK_PTR_DECL(ClusterColumn)
+#define createClusterColumn CREATE_DECL(ClusterColumn)
+
+/** @}*/
+}
+
+#endif // _OPENCOG_CLUSTER_COLUMN_H
@@ -136,4 +136,16 @@ ValuePtr GroundedPredicateNode::execute_args(AtomSpace* as,
 	      get_name().c_str());
 }
 
+ValueSeq GroundedPredicateNode::evaluate_batch(AtomSpace* as,
+                                               const std::vector<ValueSeq>& rows,
+                                               bool silent)
+{
+	if (nullptr == _runner)
+		throw RuntimeException(TRACE_INFO,
+		                       "Cannot evaluate unknown GroundedPredicateNode: %s",
+		                       to_short_string().c_str());
+
+	return _runner->evaluate_batch(as, rows, silent);
+}
+
 DEFINE_NODE_FACTORY(GroundedPredicateNode, GROUNDED_PREDICATE_NODE)
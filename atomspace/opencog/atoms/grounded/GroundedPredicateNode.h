@@ -24,6 +24,8 @@
 #ifndef _OPENCOG_GROUNDED_PREDICATE_NODE_H
 #define _OPENCOG_GROUNDED_PREDICATE_NODE_H
 
+#include <vector>
+
 #include <opencog/atoms/execution/GroundedProcedureNode.h>
 
 namespace opencog
@@ -52,6 +54,11 @@ public:
 	virtual ValuePtr execute_args(AtomSpace*, const ValuePtr&,
 	                              bool silent=false);
 
+	/// Evaluate once per row of arguments. The rows are passed to the
+	/// runner as they are; they are not placed in the AtomSpace.
+	ValueSeq evaluate_batch(AtomSpace*, const std::vector<ValueSeq>&,
+	                        bool silent=false);
+
 	static Handle factory(const Handle&);
 };
 
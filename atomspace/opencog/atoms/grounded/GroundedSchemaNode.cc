@@ -134,4 +134,16 @@ ValuePtr GroundedSchemaNode::execute_args(AtomSpace* as,
 	return _runner->execute(as, cargs, silent);
 }
 
+ValueSeq GroundedSchemaNode::execute_batch(AtomSpace* as,
+                                           const std::vector<ValueSeq>& rows,
+                                           bool silent)
+{
+	if (nullptr == _runner)
+		throw RuntimeException(TRACE_INFO,
+		                       "Cannot evaluate unknown Schema %s",
+		                       to_short_string().c_str());
+
+	return _runner->execute_batch(as, rows, silent);
+}
+
 DEFINE_NODE_FACTORY(GroundedSchemaNode, GROUNDED_SCHEMA_NODE)
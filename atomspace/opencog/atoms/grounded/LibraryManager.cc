@@ -28,6 +28,7 @@ using namespace opencog;
 
 std::unordered_map<std::string, void*> LibraryManager::_librarys;
 std::unordered_map<std::string, void*> LibraryManager::_functions;
+std::unordered_map<std::string, void*> LibraryManager::_natives;
 
 void LibraryManager::setLocalFunc(std::string libName, std::string funcName, void* func)
 {
@@ -38,11 +39,11 @@ void LibraryManager::setLocalFunc(std::string libName, std::string funcName, voi
 	_functions[funcID] = func;
 }
 
-void* LibraryManager::getFunc(std::string libName, std::string funcName)
+void* LibraryManager::getLib(const std::string& libName)
 {
 	void* libHandle;
 	if (_librarys.count(libName) == 0) {
-		// Try and load the library and function.
+		// Try and load the library.
 		libHandle = dlopen(libName.c_str(), RTLD_LAZY);
 		if (nullptr == libHandle)
 			throw RuntimeException(TRACE_INFO,
@@ -52,6 +53,12 @@ void* LibraryManager::getFunc(std::string libName, std::string funcName)
 	else {
 		libHandle = _librarys[libName];
 	}
+	return libHandle;
+}
+
+void* LibraryManager::getFunc(std::string libName, std::string funcName)
+{
+	void* libHandle = getLib(libName);
 
 	std::string funcID = libName + "\\" + funcName;
 
@@ -71,6 +78,69 @@ void* LibraryManager::getFunc(std::string libName, std::string funcName)
 	return sym;
 }
 
+// Native functions are found by way of the pointer variables that
+// OPENCOG_NATIVE_FUNCTION and OPENCOG_NATIVE_BATCH export.
+void* LibraryManager::getNativeSym(const std::string& libName,
+                                   const std::string& funcName,
+                                   const std::string& suffix)
+{
+	std::string funcID = libName + "\\" + funcName + suffix;
+	auto it = _natives.find(funcID);
+	if (it != _natives.end())
+		return it->second;
+
+	// Local functions are only ever registered, never looked up.
+	if (libName.empty())
+		return nullptr;
+
+	void* libHandle = getLib(libName);
+	if (nullptr == libHandle)
+		return nullptr;
+
+	void* sym = dlsym(libHandle, (funcName + suffix).c_str());
+	if (nullptr == sym)
+		return nullptr;
+
+	void* func = *reinterpret_cast<void**>(sym);
+	_natives[funcID] = func;
+	return func;
+}
+
+NativeFunction* LibraryManager::getNative(const std::string& libName,
+                                          const std::string& funcName)
+{
+	return reinterpret_cast<NativeFunction*>(
+		getNativeSym(libName, funcName, "_native"));
+}
+
+NativeBatchFunction* LibraryManager::getNativeBatch(const std::string& libName,
+                                                    const std::string& funcName)
+{
+	return reinterpret_cast<NativeBatchFunction*>(
+		getNativeSym(libName, funcName, "_native_batch"));
+}
+
+void LibraryManager::setLocalNative(std::string libName, std::string funcName,
+                                    NativeFunction* func)
+{
+	if (_librarys.count(libName) == 0) {
+		_librarys[libName] = NULL;
+	}
+	std::string funcID = libName + "\\" + funcName + "_native";
+	_natives[funcID] = reinterpret_cast<void*>(func);
+}
+
+void LibraryManager::setLocalNativeBatch(std::string libName,
+                                         std::string funcName,
+                                         NativeBatchFunction* func)
+{
+	if (_librarys.count(libName) == 0) {
+		_librarys[libName] = NULL;
+	}
+	std::string funcID = libName + "\\" + funcName + "_native_batch";
+	_natives[funcID] = reinterpret_cast<void*>(func);
+}
+
 void LibraryManager::parse_schema(const std::string& schema,
                                   std::string& lang,
                                   std::string& lib,
@@ -111,3 +181,14 @@ void opencog::setLocalPredicate(std::string funcName,
 {
    LibraryManager::setLocalFunc("", funcName, reinterpret_cast<void*>(func));
 }
+
+void opencog::setLocalNative(std::string funcName, NativeFunction* func)
+{
+	LibraryManager::setLocalNative("", funcName, func);
+}
+
+void opencog::setLocalNativeBatch(std::string funcName,
+                                  NativeBatchFunction* func)
+{
+	LibraryManager::setLocalNativeBatch("", funcName, func);
+}
@@ -26,15 +26,68 @@
 #include <opencog/atoms/base/Handle.h>
 #include <opencog/atomspace/AtomSpace.h>
 
+namespace opencog
+{
+/**
+ * The native calling convention for C++ grounded functions. The
+ * arguments are passed as a ValueSeq; they are not wrapped in a
+ * ListLink, and are not added to the AtomSpace. Arguments that are
+ * executable have been executed, so that e.g. a FloatValueOfLink
+ * arrives as the FloatValue it holds. The result is returned as-is;
+ * it is not copied to the heap. Predicates return a TruthValue (or
+ * any other Value they like); schemas return any Value.
+ */
+typedef ValuePtr (NativeFunction)(AtomSpace*, const ValueSeq&);
+
+/**
+ * The batch form of the native convention: one call for many rows
+ * of arguments, returning one result per row. The rows are passed
+ * exactly as given.
+ */
+typedef ValueSeq (NativeBatchFunction)(AtomSpace*,
+                                       const std::vector<ValueSeq>&);
+};
+
+/**
+ * Export a native function from a shared library, so that the
+ * GroundedSchemaNode or GroundedPredicateNode "lib: libfoo.so\NAME"
+ * calls it with the native convention. Functions that are exported
+ * plainly, as `extern "C"`, are called the old way.
+ */
+#define OPENCOG_NATIVE_FUNCTION(NAME, FUNC) \
+	extern "C" { opencog::NativeFunction* NAME##_native = FUNC; }
+
+#define OPENCOG_NATIVE_BATCH(NAME, FUNC) \
+	extern "C" { opencog::NativeBatchFunction* NAME##_native_batch = FUNC; }
+
 class LibraryManager
 {
 private:
 	static std::unordered_map<std::string, void*> _librarys;
 	static std::unordered_map<std::string, void*> _functions;
+	static std::unordered_map<std::string, void*> _natives;
+
+	static void* getLib(const std::string& libName);
+	static void* getNativeSym(const std::string& libName,
+	                          const std::string& funcName,
+	                          const std::string& suffix);
 public:
 	static void* getFunc(std::string libName,std::string funcName);
 	static void setLocalFunc(std::string libName, std::string funcName, void* func);
 
+	/**
+	 * Return the native function, or the native batch function, for
+	 * the given library and function name; null if there is none.
+	 */
+	static opencog::NativeFunction* getNative(const std::string& libName,
+	                                          const std::string& funcName);
+	static opencog::NativeBatchFunction* getNativeBatch(const std::string& libName,
+	                                                    const std::string& funcName);
+	static void setLocalNative(std::string libName, std::string funcName,
+	                           opencog::NativeFunction* func);
+	static void setLocalNativeBatch(std::string libName, std::string funcName,
+	                                opencog::NativeBatchFunction* func);
+
 	/**
 	 * Given a grounded schema name like "py: foo", extract
 	 * 1. the language, like "py"
@@ -65,5 +118,18 @@ void setLocalPredicate(std::string funcName,
  */
 void setLocalSchema(std::string funcName,
                     Handle* (*func)(AtomSpace *, Handle*));
+
+/**
+ * setLocalNative("foo", boo) is like setLocalSchema() and
+ * setLocalPredicate(), except that boo is called with the native
+ * convention, and so serves for both.
+ */
+void setLocalNative(std::string funcName, NativeFunction* func);
+
+/**
+ * setLocalNativeBatch("foo", boo) makes boo the batch form of "foo".
+ * If there is no single-call form, single calls go through boo.
+ */
+void setLocalNativeBatch(std::string funcName, NativeBatchFunction* func);
 };
 #endif //_OPENCOG_LIBRARAY_MANAGER_H
@@ -23,6 +23,7 @@
 
 #include <opencog/atoms/atom_types/atom_types.h>
 #include <opencog/atoms/truthvalue/TruthValue.h>
+#include <opencog/atoms/value/LinkValue.h>
 #include <opencog/atoms/value/Value.h>
 #include <opencog/atomspace/AtomSpace.h>
 
@@ -32,12 +33,17 @@
 using namespace opencog;
 
 LibraryRunner::LibraryRunner(std::string s)
-	: _fname(s)
+	: _fname(s), sym(nullptr)
 {
 	// Extract the language, library and function from schema
 	std::string lang, lib, fun;
 	LibraryManager::parse_schema(_fname, lang, lib, fun);
 
+	// Prefer the native convention, if the function offers it.
+	_native = LibraryManager::getNative(lib, fun);
+	_batch = LibraryManager::getNativeBatch(lib, fun);
+	if (_native or _batch) return;
+
 	sym = LibraryManager::getFunc(lib,fun);
 }
 
@@ -55,6 +61,97 @@ static void throwSyntaxEx(bool silent, const char* message...)
 
 // ----------------------------------------------------------
 
+/// Call a native function. The arguments are taken out of their
+/// ListLink or LinkValue; any that are executable are executed.
+ValuePtr LibraryRunner::native_call(AtomSpace* as,
+                                    const ValuePtr& vargs,
+                                    bool silent)
+{
+	ValueSeq args;
+	if (vargs->is_type(LIST_LINK))
+	{
+		for (const Handle& h : HandleCast(vargs)->getOutgoingSet())
+			args.emplace_back(h);
+	}
+	else if (vargs->is_type(LINK_VALUE))
+		args = LinkValueCast(vargs)->value();
+	else
+		args.emplace_back(vargs);
+
+	for (ValuePtr& v : args)
+	{
+		if (not v->is_atom()) continue;
+		Handle h(HandleCast(v));
+		if (h->is_executable())
+			v = h->execute(as, silent);
+	}
+
+	ValuePtr result;
+	if (_native)
+		result = _native(as, args);
+	else
+	{
+		ValueSeq results(_batch(as, {args}));
+		if (1 == results.size()) result = results[0];
+	}
+
+	if (nullptr == result)
+		throwSyntaxEx(silent,
+		        "Invalid return value from grounded function %s\nArgs: %s",
+		        _fname.c_str(),
+		        vargs->to_short_string().c_str());
+
+	return result;
+}
+
+/// Run a batch through the native batch function, if there is one,
+/// else row by row through the native function.
+ValueSeq LibraryRunner::native_batch(AtomSpace* as,
+                                     const std::vector<ValueSeq>& rows,
+                                     bool silent)
+{
+	ValueSeq results;
+	if (_batch)
+		results = _batch(as, rows);
+	else
+	{
+		results.reserve(rows.size());
+		for (const ValueSeq& row : rows)
+			results.emplace_back(_native(as, row));
+	}
+
+	if (results.size() != rows.size())
+		throwSyntaxEx(silent,
+		        "Grounded function %s returned %zu results for %zu rows",
+		        _fname.c_str(), results.size(), rows.size());
+
+	for (const ValuePtr& v : results)
+		if (nullptr == v)
+			throwSyntaxEx(silent,
+			        "Invalid return value from grounded function %s",
+			        _fname.c_str());
+
+	return results;
+}
+
+ValueSeq LibraryRunner::execute_batch(AtomSpace* as,
+                                      const std::vector<ValueSeq>& rows,
+                                      bool silent)
+{
+	if (nullptr == sym) return native_batch(as, rows, silent);
+	return Runner::execute_batch(as, rows, silent);
+}
+
+ValueSeq LibraryRunner::evaluate_batch(AtomSpace* as,
+                                       const std::vector<ValueSeq>& rows,
+                                       bool silent)
+{
+	if (nullptr == sym) return native_batch(as, rows, silent);
+	return Runner::evaluate_batch(as, rows, silent);
+}
+
+// ----------------------------------------------------------
+
 /// `execute()` -- evaluate a LibraryRunner with arguments.
 ///
 /// Expects "args" to be a ListLink. These arguments will be
@@ -64,6 +161,8 @@ ValuePtr LibraryRunner::execute(AtomSpace* as,
                                const ValuePtr& vargs,
                                bool silent)
 {
+	if (nullptr == sym) return native_call(as, vargs, silent);
+
 	if (not vargs->is_atom())
 		throw SyntaxException(TRACE_INFO,
 			"LibraryRunner: Expecting Handle; got %s",
@@ -99,6 +198,8 @@ ValuePtr LibraryRunner::evaluate(AtomSpace* as,
                                 const ValuePtr& vargs,
                                 bool silent)
 {
+	if (nullptr == sym) return native_call(as, vargs, silent);
+
 	if (not vargs->is_atom())
 		throw SyntaxException(TRACE_INFO,
 			"LibraryRunner: Expecting Handle; got %s",
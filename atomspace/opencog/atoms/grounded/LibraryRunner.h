@@ -25,6 +25,7 @@
 #define _OPENCOG_LIBRARY_RUNNER_H
 
 #include <string>
+#include <opencog/atoms/grounded/LibraryManager.h>
 #include <opencog/atoms/grounded/Runner.h>
 
 namespace opencog
@@ -34,11 +35,22 @@ namespace opencog
  */
 
 /// Generic shared-library foreign-function interface.
-/// Currently used only by the Haskell bindings.
+/// Used by the Haskell bindings, and by C++ code.
+///
+/// Functions come in two calling conventions; see LibraryManager.h.
+/// The old one takes the arguments as a Handle, after adding them to
+/// the AtomSpace, and returns a heap-allocated Handle* or
+/// TruthValuePtr*. The native one takes and returns Values, and can
+/// also run a whole batch of argument rows in one call.
 class LibraryRunner : public Runner
 {
 	std::string _fname;
 	void* sym;
+	NativeFunction* _native;
+	NativeBatchFunction* _batch;
+
+	ValuePtr native_call(AtomSpace*, const ValuePtr&, bool);
+	ValueSeq native_batch(AtomSpace*, const std::vector<ValueSeq>&, bool);
 
 public:
 	LibraryRunner(const std::string);
@@ -47,6 +59,11 @@ public:
 
 	virtual ValuePtr execute(AtomSpace*, const ValuePtr&, bool=false);
 	virtual ValuePtr evaluate(AtomSpace*, const ValuePtr&, bool=false);
+
+	virtual ValueSeq execute_batch(AtomSpace*,
+	                               const std::vector<ValueSeq>&, bool=false);
+	virtual ValueSeq evaluate_batch(AtomSpace*,
+	                                const std::vector<ValueSeq>&, bool=false);
 };
 
 /** @}*/
@@ -0,0 +1,63 @@
+/*
+ * opencog/atoms/grounded/Runner.cc
+ *
+ * Copyright (C) 2026 OpenCog Foundation
+ * SPDX-License-Identifier: AGPL-3.0-or-later
+ * All Rights Reserved
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License v3 as
+ * published by the Free Software Foundation and including the exceptions
+ * at http://opencog.org/wiki/Licenses
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program; if not, write to:
+ * Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <opencog/atoms/base/Link.h>
+#include <opencog/atoms/value/LinkValue.h>
+
+#include <opencog/atoms/grounded/Runner.h>
+
+using namespace opencog;
+
+static ValuePtr wrap_row(const ValueSeq& row)
+{
+	HandleSeq oset;
+	for (const ValuePtr& v : row)
+	{
+		if (not v->is_atom())
+			return createLinkValue(row);
+		oset.emplace_back(HandleCast(v));
+	}
+	return createLink(std::move(oset), LIST_LINK);
+}
+
+ValueSeq Runner::evaluate_batch(AtomSpace* as,
+                                const std::vector<ValueSeq>& rows,
+                                bool silent)
+{
+	ValueSeq results;
+	results.reserve(rows.size());
+	for (const ValueSeq& row : rows)
+		results.emplace_back(evaluate(as, wrap_row(row), silent));
+	return results;
+}
+
+ValueSeq Runner::execute_batch(AtomSpace* as,
+                               const std::vector<ValueSeq>& rows,
+                               bool silent)
+{
+	ValueSeq results;
+	results.reserve(rows.size());
+	for (const ValueSeq& row : rows)
+		results.emplace_back(execute(as, wrap_row(row), silent));
+	return results;
+}
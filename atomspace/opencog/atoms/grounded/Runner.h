@@ -24,6 +24,7 @@
 #ifndef _OPENCOG_RUNNER_H
 #define _OPENCOG_RUNNER_H
 
+#include <vector>
 #include <opencog/atoms/value/Value.h>
 
 namespace opencog {
@@ -44,6 +45,15 @@ public:
 
 	virtual ValuePtr evaluate(AtomSpace*, const ValuePtr&, bool=false) = 0;
 	virtual ValuePtr execute(AtomSpace*, const ValuePtr&, bool=false) = 0;
+
+	/// Run once for each row of arguments, returning one result per
+	/// row. By default, each row is wrapped in a ListLink (or, if it
+	/// holds non-atoms, a LinkValue) and run in turn. Runners that can
+	/// do better override these.
+	virtual ValueSeq evaluate_batch(AtomSpace*,
+	                                const std::vector<ValueSeq>&, bool=false);
+	virtual ValueSeq execute_batch(AtomSpace*,
+	                               const std::vector<ValueSeq>&, bool=false);
 };
 
 /** @}*/
@@ -24,7 +24,7 @@
 #include <thread>
 
 #include <opencog/util/platform.h>
-#include <opencog/util/concurrent_queue.h>
+#include <opencog/util/concurrent_ring.h>
 
 #include <opencog/atoms/core/NumberNode.h>
 #include <opencog/atoms/execution/Instantiator.h>
@@ -88,7 +88,7 @@ ExecuteThreadedLink::ExecuteThreadedLink(const HandleSeq&& oset, Type t)
 }
 
 static void thread_exec(AtomSpace* as, bool silent,
-                        concurrent_queue<Handle>* todo,
+                        concurrent_ring<Handle>* todo,
                         QueueValuePtr qvp,
                         std::exception_ptr* returned_ex)
 {
@@ -118,14 +118,16 @@ static void thread_exec(AtomSpace* as, bool silent,
 ValuePtr ExecuteThreadedLink::execute(AtomSpace* as,
                                       bool silent)
 {
-	// Place the work items onto a queue.
-	concurrent_queue<Handle> todo_list;
+	// Place the work items onto a queue, all at once. The workers
+	// only ever pop, so a ring that holds everything is enough.
 	const HandleSeq& exes = _outgoing[_setoff]->getOutgoingSet();
-	for (const Handle& h: exes)
-		todo_list.push(h);
+	concurrent_ring<Handle> todo_list(exes.size());
+	todo_list.try_push_batch(exes.begin(), exes.end());
 
-	// Where the results will be reported.
-	QueueValuePtr qvp(createQueueValue());
+	// Where the results will be reported. There is at most one per
+	// work item, so the ring never spills, and the workers never
+	// contend on its overflow lock.
+	QueueValuePtr qvp(createQueueValue(exes.size()));
 
 	// Create a collection of joinable threads.
 	std::vector<std::thread> thread_set;
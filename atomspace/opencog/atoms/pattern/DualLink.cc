@@ -24,6 +24,7 @@
 #include <opencog/atoms/atom_types/NameServer.h>
 #include <opencog/atoms/core/UnorderedLink.h>
 #include <opencog/query/Recognizer.h>
+#include <opencog/query/RuleIndex.h>
 
 #include "DualLink.h"
 
@@ -78,6 +79,11 @@ ValuePtr DualLink::execute(AtomSpace* as, bool silent)
 {
 	if (nullptr == as) as = _atom_space;
 	Recognizer reco(as);
+
+	// If the rules are indexed, look at the likely ones only.
+	RuleIndexPtr idx(RuleIndex::get(as));
+	if (idx) reco.set_candidates(idx->get_candidates(_body));
+
 	reco.satisfy(PatternLinkCast(get_handle()));
 	return as->add_atom(createUnorderedLink(reco._rules, SET_LINK));
 }
@@ -158,8 +158,13 @@ Handle ArithmeticLink::reorder(void) const
 // ===========================================================
 
 /// execute() -- Execute the expression
+///
+/// Purely numeric formulas are run as compiled bytecode; see
+/// FormulaProgram.h. Everything else is delta-reduced.
 ValuePtr ArithmeticLink::execute(AtomSpace* as, bool silent)
 {
+	ValuePtr vp(_compiled.execute(get_handle(), as));
+	if (vp) return vp;
 	return delta_reduce(as, silent);
 }
 
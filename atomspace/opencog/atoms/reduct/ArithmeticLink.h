@@ -24,6 +24,7 @@
 #define _OPENCOG_ARITHMETIC_LINK_H
 
 #include <opencog/atoms/reduct/FoldLink.h>
+#include <opencog/atoms/reduct/FormulaProgram.h>
 
 namespace opencog
 {
@@ -43,6 +44,8 @@ protected:
 	virtual Handle reorder(void) const;
 	bool _commutative;
 
+	FormulaCache _compiled;
+
 
 public:
 	ArithmeticLink(const HandleSeq&&, Type);
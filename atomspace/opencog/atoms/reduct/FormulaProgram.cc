@@ -0,0 +1,468 @@
+/*
+ * opencog/atoms/reduct/FormulaProgram.cc
+ *
+ * Copyright (C) 2026 OpenCog Foundation
+ * All Rights Reserved
+ * SPDX-License-Identifier: AGPL-3.0-or-later
+ */
+
+#include <cmath>
+
+#include <opencog/atoms/atom_types/atom_types.h>
+#include <opencog/atoms/atom_types/NameServer.h>
+#include <opencog/atoms/core/NumberNode.h>
+#include <opencog/atoms/value/FloatValue.h>
+#include <opencog/atomspace/AtomSpace.h>
+#include "FormulaProgram.h"
+
+using namespace opencog;
+
+// Same as in NumericFunctionLink.cc
+static double impulse(double x) { return 1-std::signbit(x); }
+
+void FormulaProgram::op(Opcode o, uint32_t arg)
+{
+	_code.push_back({o, arg});
+}
+
+FormulaProgramPtr FormulaProgram::compile(const Handle& h)
+{
+	std::shared_ptr<FormulaProgram> prog(new FormulaProgram());
+	size_t maxdepth = 0;
+	if (not prog->emit(h, 0, maxdepth)) return nullptr;
+	if (MAX_DEPTH < maxdepth) return nullptr;
+	prog->_depth = maxdepth;
+	prog->_code.shrink_to_fit();
+	return prog;
+}
+
+// ===========================================================
+
+/// Emit code for a leaf, i.e. something that pushes one number.
+bool FormulaProgram::emit_leaf(const Handle& h)
+{
+	Type t = h->get_type();
+	size_t arity = h->is_link() ? h->get_arity() : 0;
+
+	if (NUMBER_NODE == t)
+	{
+		const std::vector<double>& v = NumberNodeCast(h)->value();
+		if (0 == v.size()) return false;
+		if (1 == v.size())
+		{
+			op(PUSH, _consts.size());
+			_consts.push_back(v[0]);
+		}
+		else
+		{
+			op(PUSH_VEC, _vconsts.size());
+			_vconsts.push_back(v);
+		}
+		return true;
+	}
+
+	// Value at a fixed key on a fixed Atom. The optional third atom
+	// is a default; if it is needed, the slow path can supply it.
+	if ((VALUE_OF_LINK == t or FLOAT_VALUE_OF_LINK == t) and
+	    (2 == arity or 3 == arity))
+	{
+		op(LOAD_VALUE, _atoms.size());
+		_atoms.push_back(h->getOutgoingAtom(0));
+		_atoms.push_back(h->getOutgoingAtom(1));
+		return true;
+	}
+
+	if ((STRENGTH_OF_LINK == t or CONFIDENCE_OF_LINK == t or
+	     COUNT_OF_LINK == t) and 1 == arity)
+	{
+		// Anything that has to be evaluated to get a TruthValue,
+		// or is a variable, is left to the slow path.
+		const Handle& tva = h->getOutgoingAtom(0);
+		Type tt = tva->get_type();
+		if (VARIABLE_NODE == tt or GLOB_NODE == tt or
+		    tva->is_evaluatable() or
+		    nameserver().isA(tt, EVALUATABLE_LINK))
+			return false;
+
+		if (STRENGTH_OF_LINK == t) op(LOAD_STRENGTH, _atoms.size());
+		else if (CONFIDENCE_OF_LINK == t) op(LOAD_CONFIDENCE, _atoms.size());
+		else op(LOAD_COUNT, _atoms.size());
+		_atoms.push_back(tva);
+		return true;
+	}
+
+	return false;
+}
+
+/// Emit code that leaves the value of `h` on top of the stack.
+/// `depth` is the height of the stack before this runs; `maxdepth`
+/// records the largest height seen.
+bool FormulaProgram::emit(const Handle& h, size_t depth, size_t& maxdepth)
+{
+	maxdepth = std::max(maxdepth, depth + 1);
+	if (MAX_DEPTH < maxdepth) return false;
+
+	Type t = h->get_type();
+
+	// ArithmeticLinks are right folds. The commutative ones are
+	// first reordered, compound expressions before numbers, exactly
+	// as ArithmeticLink::reorder() does. Reordered operands are then
+	// folded right to left; on the stack, that is just pushing them
+	// all, and applying the operator n-1 times.
+	if (PLUS_LINK == t or MINUS_LINK == t or
+	    TIMES_LINK == t or DIVIDE_LINK == t)
+	{
+		HandleSeq args;
+		if (PLUS_LINK == t or TIMES_LINK == t)
+		{
+			HandleSeq numbers;
+			for (const Handle& a : h->getOutgoingSet())
+			{
+				if (NUMBER_NODE == a->get_type()) numbers.push_back(a);
+				else args.push_back(a);
+			}
+			args.insert(args.end(), numbers.begin(), numbers.end());
+		}
+		else
+			args = h->getOutgoingSet();
+
+		if (0 == args.size()) return false;
+
+		for (size_t i = 0; i < args.size(); i++)
+			if (not emit(args[i], depth + i, maxdepth)) return false;
+
+		Opcode o = ADD;
+		if (MINUS_LINK == t) o = SUB;
+		else if (TIMES_LINK == t) o = MUL;
+		else if (DIVIDE_LINK == t) o = DIV;
+		for (size_t i = 1; i < args.size(); i++) op(o);
+		return true;
+	}
+
+	double (*f1)(double) = nullptr;
+	if (FLOOR_LINK == t) f1 = floor;
+	else if (HEAVISIDE_LINK == t) f1 = impulse;
+	else if (LOG2_LINK == t) f1 = log2;
+	else if (SINE_LINK == t) f1 = sin;
+	else if (COSINE_LINK == t) f1 = cos;
+	else if (TAN_LINK == t) f1 = tan;
+	else if (EXP_LINK == t) f1 = exp;
+
+	if (f1)
+	{
+		if (1 != h->get_arity()) return false;
+		if (not emit(h->getOutgoingAtom(0), depth, maxdepth)) return false;
+		op(CALL1, _func1.size());
+		_func1.push_back(f1);
+		return true;
+	}
+
+	// RandomNumberLink is not pure, and so it is not compiled.
+	if (POW_LINK == t)
+	{
+		if (2 != h->get_arity()) return false;
+		if (not emit(h->getOutgoingAtom(0), depth, maxdepth)) return false;
+		if (not emit(h->getOutgoingAtom(1), depth + 1, maxdepth)) return false;
+		op(CALL2, _func2.size());
+		_func2.push_back(pow);
+		return true;
+	}
+
+	return emit_leaf(h);
+}
+
+// ===========================================================
+
+/// Get the unique copy of `h` that the slow path would use.
+/// When the formula already lives in `as`, this costs nothing.
+static inline const Handle& in_space(AtomSpace* as, const Handle& h,
+                                     Handle& tmp)
+{
+	if (nullptr == as or h->getAtomSpace() == as) return h;
+	tmp = as->add_atom(h);
+	return tmp;
+}
+
+/// Fetch the numbers for a LOAD_VALUE. Returns nullptr if there
+/// is no value, or if it is not numeric. The value is returned, so
+/// that the caller can keep it alive while using `vec`.
+ValuePtr FormulaProgram::fetch(AtomSpace* as, uint32_t arg,
+                               const std::vector<double>*& vec,
+                               bool& is_float) const
+{
+	// ValueOfLink cannot run without an AtomSpace.
+	if (nullptr == as) return nullptr;
+	Handle ta, tk;
+	const Handle& ah = in_space(as, _atoms[arg], ta);
+	const Handle& ak = in_space(as, _atoms[arg+1], tk);
+	ValuePtr vp(ah->getValue(ak));
+	if (nullptr == vp) return nullptr;
+
+	Type vt = vp->get_type();
+	if (FLOAT_VALUE == vt)
+	{
+		vec = &FloatValueCast(vp)->value();
+		is_float = true;
+	}
+	else if (NUMBER_NODE == vt)
+		vec = &NumberNodeCast(vp)->value();
+	else
+		return nullptr;
+
+	if (0 == vec->size()) return nullptr;
+	return vp;
+}
+
+double FormulaProgram::fetch_tv(AtomSpace* as, const Insn& insn) const
+{
+	Handle ta;
+	const Handle& ah = in_space(as, _atoms[insn.arg], ta);
+	TruthValuePtr tv(ah->getTruthValue());
+	if (LOAD_STRENGTH == insn.op) return tv->get_mean();
+	if (LOAD_CONFIDENCE == insn.op) return tv->get_confidence();
+	return tv->get_count();
+}
+
+// ===========================================================
+
+FormulaProgram::Status
+FormulaProgram::run_scalar(AtomSpace* as, double& result, bool& is_float) const
+{
+	double stack[MAX_DEPTH];
+	size_t sp = 0;
+
+	for (const Insn& insn : _code)
+	{
+		switch (insn.op)
+		{
+			case PUSH:
+				stack[sp++] = _consts[insn.arg];
+				break;
+
+			case PUSH_VEC:
+				return VECTOR;
+
+			case LOAD_VALUE:
+			{
+				const std::vector<double>* vec;
+				ValuePtr vp(fetch(as, insn.arg, vec, is_float));
+				if (nullptr == vp) return FAIL;
+				if (1 != vec->size()) return VECTOR;
+				stack[sp++] = (*vec)[0];
+				break;
+			}
+
+			case LOAD_STRENGTH:
+			case LOAD_CONFIDENCE:
+			case LOAD_COUNT:
+				stack[sp++] = fetch_tv(as, insn);
+				is_float = true;
+				break;
+
+			case ADD:
+				sp--; stack[sp-1] = stack[sp-1] + stack[sp];
+				break;
+			case SUB:
+				sp--; stack[sp-1] = stack[sp-1] - stack[sp];
+				break;
+			case MUL:
+				sp--; stack[sp-1] = stack[sp-1] * stack[sp];
+				break;
+			case DIV:
+				sp--; stack[sp-1] = stack[sp-1] / stack[sp];
+				break;
+
+			case CALL1:
+				stack[sp-1] = _func1[insn.arg](stack[sp-1]);
+				break;
+			case CALL2:
+				sp--; stack[sp-1] = _func2[insn.arg](stack[sp-1], stack[sp]);
+				break;
+		}
+	}
+
+	result = stack[0];
+	return OK;
+}
+
+// ===========================================================
+
+/// Run the program over vectors, fusing the whole formula into a
+/// single pass. The vectors are cut into blocks small enough to stay
+/// in the L1 cache; each instruction then runs a vectorized kernel
+/// over one block. The only allocations are one block per stack slot,
+/// and the final result.
+///
+/// Every vector must have the same length; single numbers are applied
+/// to every element. Vectors of different lengths are padded in ways
+/// that depend on the operator; that is left to the clearbox code.
+ValuePtr FormulaProgram::run_vector(AtomSpace* as) const
+{
+	static const size_t BLOCK = 256;
+
+	// A leaf: either a single number, or a whole vector.
+	struct Leaf { const double* p; bool scalar; };
+	std::vector<Leaf> leaves;
+	leaves.reserve(_code.size());
+
+	// Keep fetched values alive, and TV numbers in place.
+	ValueSeq held;
+	std::vector<double> tvs;
+	tvs.reserve(_code.size());
+
+	bool is_float = false;
+	size_t len = 1;
+	for (const Insn& insn : _code)
+	{
+		const std::vector<double>* vec = nullptr;
+		switch (insn.op)
+		{
+			case PUSH:
+				leaves.push_back({&_consts[insn.arg], true});
+				continue;
+			case PUSH_VEC:
+				vec = &_vconsts[insn.arg];
+				break;
+			case LOAD_VALUE:
+			{
+				ValuePtr vp(fetch(as, insn.arg, vec, is_float));
+				if (nullptr == vp) return nullptr;
+				held.emplace_back(vp);
+				break;
+			}
+			case LOAD_STRENGTH:
+			case LOAD_CONFIDENCE:
+			case LOAD_COUNT:
+				tvs.push_back(fetch_tv(as, insn));
+				leaves.push_back({&tvs.back(), true});
+				is_float = true;
+				continue;
+			default:
+				continue;
+		}
+
+		size_t vlen = vec->size();
+		if (1 == vlen)
+		{
+			leaves.push_back({vec->data(), true});
+			continue;
+		}
+		if (1 != len and vlen != len) return nullptr;
+		len = vlen;
+		leaves.push_back({vec->data(), false});
+	}
+
+	std::vector<double> out(len);
+	std::vector<double> buf(_depth * BLOCK);
+	Leaf stack[MAX_DEPTH];
+
+	for (size_t lo = 0; lo < len; lo += BLOCK)
+	{
+		size_t n = std::min(BLOCK, len - lo);
+		size_t sp = 0;
+		size_t nleaf = 0;
+		for (const Insn& insn : _code)
+		{
+			// The leaf opcodes all come before ADD.
+			if (insn.op < ADD)
+			{
+				const Leaf& lf = leaves[nleaf++];
+				stack[sp++] = lf.scalar ? lf : Leaf{lf.p + lo, false};
+				continue;
+			}
+
+			// Results are written to the block owned by their slot.
+			// The kernels allow the result to overwrite an operand.
+			if (CALL1 == insn.op)
+			{
+				Leaf a = stack[sp-1];
+				double* r = &buf[(sp-1) * BLOCK];
+				double (*f)(double) = _func1[insn.arg];
+				size_t m = a.scalar ? 1 : n;
+				for (size_t i = 0; i < m; i++) r[i] = f(a.p[i]);
+				stack[sp-1] = {r, a.scalar};
+				continue;
+			}
+
+			Leaf b = stack[--sp];
+			Leaf a = stack[sp-1];
+			double* r = &buf[(sp-1) * BLOCK];
+
+			if (CALL2 == insn.op)
+			{
+				double (*f)(double, double) = _func2[insn.arg];
+				if (a.scalar and b.scalar) r[0] = f(a.p[0], b.p[0]);
+				else if (a.scalar)
+					for (size_t i = 0; i < n; i++) r[i] = f(a.p[0], b.p[i]);
+				else if (b.scalar)
+					for (size_t i = 0; i < n; i++) r[i] = f(a.p[i], b.p[0]);
+				else
+					for (size_t i = 0; i < n; i++) r[i] = f(a.p[i], b.p[i]);
+			}
+			else if (a.scalar and b.scalar)
+			{
+				double x = a.p[0], y = b.p[0];
+				if (ADD == insn.op) r[0] = x + y;
+				else if (SUB == insn.op) r[0] = x - y;
+				else if (MUL == insn.op) r[0] = x * y;
+				else r[0] = x / y;
+			}
+			else if (a.scalar)
+			{
+				if (ADD == insn.op) plus(r, a.p[0], b.p, n);
+				else if (SUB == insn.op) minus(r, a.p[0], b.p, n);
+				else if (MUL == insn.op) times(r, a.p[0], b.p, n);
+				else divide(r, a.p[0], b.p, n);
+			}
+			else if (b.scalar)
+			{
+				if (ADD == insn.op) plus(r, b.p[0], a.p, n);
+				else if (SUB == insn.op) minus(r, a.p, b.p[0], n);
+				else if (MUL == insn.op) times(r, b.p[0], a.p, n);
+				else divide(r, a.p, b.p[0], n);
+			}
+			else
+			{
+				if (ADD == insn.op) plus(r, a.p, b.p, n);
+				else if (SUB == insn.op) minus(r, a.p, b.p, n);
+				else if (MUL == insn.op) times(r, a.p, b.p, n);
+				else divide(r, a.p, b.p, n);
+			}
+			stack[sp-1] = {r, a.scalar and b.scalar};
+		}
+
+		// Every leaf feeds into the result, so if any one of them
+		// is a vector, then so is the result.
+		if (stack[0].scalar) out.assign(1, stack[0].p[0]);
+		else std::copy(stack[0].p, stack[0].p + n, out.begin() + lo);
+	}
+
+	if (is_float)
+		return createFloatValue(std::move(out));
+	return createNumberNode(out);
+}
+
+// ===========================================================
+
+bool FormulaProgram::run(AtomSpace* as, double& result) const
+{
+	bool is_float = false;
+	return OK == run_scalar(as, result, is_float);
+}
+
+ValuePtr FormulaProgram::execute(AtomSpace* as) const
+{
+	double result;
+	bool is_float = false;
+	Status st = run_scalar(as, result, is_float);
+	if (VECTOR == st) return run_vector(as);
+	if (FAIL == st) return nullptr;
+
+	// Same wrapping as the clearbox kons: Number op Number is a
+	// Number, anything else is a FloatValue.
+	if (is_float)
+		return createFloatValue(std::vector<double>({result}));
+	return createNumberNode(std::vector<double>({result}));
+}
+
+/* ===================== END OF FILE ===================== */
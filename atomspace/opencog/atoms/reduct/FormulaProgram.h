@@ -0,0 +1,155 @@
+/*
+ * opencog/atoms/reduct/FormulaProgram.h
+ *
+ * Copyright (C) 2026 OpenCog Foundation
+ * All Rights Reserved
+ * SPDX-License-Identifier: AGPL-3.0-or-later
+ */
+
+#ifndef _OPENCOG_FORMULA_PROGRAM_H
+#define _OPENCOG_FORMULA_PROGRAM_H
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <opencog/atoms/base/Handle.h>
+#include <opencog/atoms/value/Value.h>
+
+namespace opencog
+{
+/** \addtogroup grp_atomspace
+ *  @{
+ */
+
+class AtomSpace;
+class FormulaProgram;
+typedef std::shared_ptr<const FormulaProgram> FormulaProgramPtr;
+
+/**
+ * A FormulaProgram is an arithmetic formula, compiled down to a
+ * short sequence of stack-machine instructions.
+ *
+ * Executing a tree of PlusLinks, TimesLinks and so on costs a virtual
+ * execute() per node, plus a NumberNode or FloatValue for every
+ * intermediate result. For scalar formulas -- PLN truth-value
+ * formulas, mutual-information computations over counts -- that
+ * overhead swamps the actual arithmetic. The compiled program walks
+ * a flat instruction array, keeps intermediate results in a small
+ * array of doubles, and allocates only the final result.
+ *
+ * The leaves can be NumberNodes, ValueOfLinks and FloatValueOfLinks
+ * on a fixed Atom and key, and StrengthOfLinks, ConfidenceOfLinks and
+ * CountOfLinks on a single fixed Atom. The operators can be Plus,
+ * Minus, Times, Divide, and the pure unary and binary
+ * NumericFunctionLinks. Anything else (variables, RandomNumberLink,
+ * general executable atoms) is left to the usual clearbox reduction.
+ *
+ * When some leaf is a vector, the whole formula is run as one fused
+ * pass over the vectors, in cache-sized blocks, using the vectorized
+ * kernels in FloatValue.h. A nested expression over large FloatValues
+ * thus makes no full-sized temporaries. All of the vectors must have
+ * the same length; single numbers are applied to every element.
+ *
+ * The program reproduces the clearbox evaluation order exactly: the
+ * operands of commutative links are reordered in the same way, and
+ * all folds are right folds. Thus, compiled and interpreted results
+ * are bit-for-bit identical.
+ */
+class FormulaProgram
+{
+public:
+	enum Opcode : uint8_t
+	{
+		PUSH,          // push a constant
+		PUSH_VEC,      // push a constant vector
+		LOAD_VALUE,    // push the value on an Atom, at a key
+		LOAD_STRENGTH, // push the TruthValue strength of an Atom
+		LOAD_CONFIDENCE,
+		LOAD_COUNT,
+		ADD, SUB, MUL, DIV,
+		CALL1,         // apply a unary function to the top of stack
+		CALL2,         // apply a binary function to the top two
+	};
+
+	struct Insn
+	{
+		Opcode op;
+		uint32_t arg;
+	};
+
+	/// Programs deeper than this are not compiled.
+	static const size_t MAX_DEPTH = 64;
+
+private:
+	std::vector<Insn> _code;
+	std::vector<double> _consts;
+	std::vector<std::vector<double>> _vconsts;
+	HandleSeq _atoms;
+	std::vector<double (*)(double)> _func1;
+	std::vector<double (*)(double, double)> _func2;
+	size_t _depth;
+
+	enum Status { OK, VECTOR, FAIL };
+	Status run_scalar(AtomSpace*, double&, bool&) const;
+	ValuePtr run_vector(AtomSpace*) const;
+
+	ValuePtr fetch(AtomSpace*, uint32_t, const std::vector<double>*&,
+	               bool&) const;
+	double fetch_tv(AtomSpace*, const Insn&) const;
+
+	bool emit(const Handle&, size_t depth, size_t& maxdepth);
+	bool emit_leaf(const Handle&);
+	void op(Opcode, uint32_t = 0);
+
+	FormulaProgram() : _depth(0) {}
+
+public:
+	/// Compile the formula, returning nullptr if it cannot be compiled.
+	static FormulaProgramPtr compile(const Handle&);
+
+	/// Run the program on scalars. Returns false if some leaf did
+	/// not hold a single number.
+	bool run(AtomSpace*, double&) const;
+
+	/// Run the program, wrapping the result the same way that the
+	/// clearbox reduction does: a NumberNode if all of the leaves
+	/// are NumberNodes, else a FloatValue. Returns nullptr if some
+	/// leaf was not numeric, or if the vector lengths differ; the
+	/// caller must then fall back to ordinary execution.
+	ValuePtr execute(AtomSpace*) const;
+
+	size_t size() const { return _code.size(); }
+	const std::vector<Insn>& code() const { return _code; }
+};
+
+/**
+ * Holds the compiled form of one formula Link. The formula is compiled
+ * the first time it is run; if it cannot be compiled, that is also
+ * remembered, so that the attempt is never repeated.
+ *
+ * Only Links that sit in an AtomSpace are compiled. Those are the
+ * formulas that get run over and over; the scratch links created
+ * during reduction are run once, and then discarded.
+ */
+class FormulaCache
+{
+	std::once_flag _once;
+	FormulaProgramPtr _program;
+
+public:
+	/// Run the compiled form of `h`, if there is one. Returns nullptr
+	/// if the caller must use ordinary execution.
+	ValuePtr execute(const Handle& h, AtomSpace* as)
+	{
+		if (nullptr == h->getAtomSpace()) return nullptr;
+		std::call_once(_once, [&]() { _program = FormulaProgram::compile(h); });
+		if (nullptr == _program) return nullptr;
+		return _program->execute(as);
+	}
+};
+
+/** @}*/
+}
+
+#endif // _OPENCOG_FORMULA_PROGRAM_H
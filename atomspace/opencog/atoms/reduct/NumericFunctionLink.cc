@@ -304,6 +304,10 @@ ValuePtr NumericFunctionLink::execute_binary(AtomSpace *as, bool silent)
 
 ValuePtr NumericFunctionLink::execute(AtomSpace* as, bool silent)
 {
+	// Purely numeric formulas are run as compiled bytecode.
+	ValuePtr vp(_compiled.execute(get_handle(), as));
+	if (vp) return vp;
+
 	if (1 == _outgoing.size())
 		return execute_unary(as, silent);
 	return execute_binary(as, silent);
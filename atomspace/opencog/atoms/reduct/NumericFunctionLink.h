@@ -24,6 +24,7 @@
 #define _OPENCOG_NUMERIC_FUNCTION_LINK_H
 
 #include <opencog/atoms/core/FunctionLink.h>
+#include <opencog/atoms/reduct/FormulaProgram.h>
 
 namespace opencog
 {
@@ -39,6 +40,9 @@ class NumericFunctionLink : public FunctionLink
 {
 protected:
 	void init();
+
+	FormulaCache _compiled;
+
 	ValuePtr execute_unary(AtomSpace*, bool);
 	ValuePtr execute_binary(AtomSpace*, bool);
 
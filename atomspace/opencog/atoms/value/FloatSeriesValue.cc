@@ -0,0 +1,292 @@
+/*
+ * opencog/atoms/value/FloatSeriesValue.cc
+ *
+ * Copyright (C) 2026 OpenCog Foundation
+ * All Rights Reserved
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License v3 as
+ * published by the Free Software Foundation and including the exceptions
+ * at http://opencog.org/wiki/Licenses
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program; if not, write to:
+ * Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <chrono>
+#include <cmath>
+
+#include <opencog/util/exceptions.h>
+#include <opencog/atoms/value/FloatSeriesValue.h>
+#include <opencog/atoms/value/ValueFactory.h>
+
+using namespace opencog;
+
+// ==============================================================
+
+FloatSeriesValue::FloatSeriesValue(size_t capacity)
+	: FloatValue(FLOAT_SERIES_VALUE),
+	  _capacity(capacity), _total(0), _head(0)
+{
+	if (0 == _capacity)
+		throw InvalidParamException(TRACE_INFO,
+			"FloatSeriesValue capacity must be at least one");
+}
+
+/// Decode the printed form: capacity, total, then pairs of
+/// (timestamp, sample). The total is optional; if absent, it
+/// is taken to be the number of pairs.
+FloatSeriesValue::FloatSeriesValue(const std::vector<double>& v)
+	: FloatValue(FLOAT_SERIES_VALUE), _total(0), _head(0)
+{
+	if (0 == v.size() or v[0] < 1.0)
+		throw InvalidParamException(TRACE_INFO,
+			"FloatSeriesValue expects a capacity of at least one");
+	_capacity = (size_t) v[0];
+
+	if (1 == v.size()) return;
+
+	if (1 == v.size() % 2)
+		throw InvalidParamException(TRACE_INFO,
+			"FloatSeriesValue expects (timestamp, sample) pairs");
+
+	size_t npairs = (v.size() - 2) / 2;
+	uint64_t total = (uint64_t) v[1];
+	if (total < npairs)
+		throw InvalidParamException(TRACE_INFO,
+			"FloatSeriesValue total %lu is less than the sample count %zu",
+			(unsigned long) total, npairs);
+
+	for (size_t i = 2; i < v.size(); i += 2)
+		do_append(v[i], v[i+1]);
+
+	// Appending may have dropped samples, if there were more
+	// than the capacity; the total is authoritative regardless.
+	_total = total;
+}
+
+// ==============================================================
+
+void FloatSeriesValue::do_append(double stamp, double sample)
+{
+	size_t n = _samples.size();
+	if (0 < n and stamp < _stamps[physical(n-1)])
+		throw InvalidParamException(TRACE_INFO,
+			"FloatSeriesValue timestamps must be non-decreasing");
+
+	if (n < _capacity)
+	{
+		_stamps.push_back(stamp);
+		_samples.push_back(sample);
+	}
+	else
+	{
+		_stamps[_head] = stamp;
+		_samples[_head] = sample;
+		_head = (_head + 1) % _capacity;
+	}
+	_total++;
+}
+
+void FloatSeriesValue::append(double sample)
+{
+	using namespace std::chrono;
+	double now = duration<double>(
+		system_clock::now().time_since_epoch()).count();
+	append(now, sample);
+}
+
+void FloatSeriesValue::append(double stamp, double sample)
+{
+	std::lock_guard<std::mutex> lck(_mtx);
+	do_append(stamp, sample);
+}
+
+void FloatSeriesValue::append(const std::vector<double>& stamps,
+                              const std::vector<double>& samples)
+{
+	if (stamps.size() != samples.size())
+		throw InvalidParamException(TRACE_INFO,
+			"FloatSeriesValue: mismatched timestamp and sample counts");
+
+	std::lock_guard<std::mutex> lck(_mtx);
+	for (size_t i = 0; i < stamps.size(); i++)
+		do_append(stamps[i], samples[i]);
+}
+
+// ==============================================================
+
+uint64_t FloatSeriesValue::total() const
+{
+	std::lock_guard<std::mutex> lck(_mtx);
+	return _total;
+}
+
+size_t FloatSeriesValue::size() const
+{
+	std::lock_guard<std::mutex> lck(_mtx);
+	return _samples.size();
+}
+
+void FloatSeriesValue::update() const
+{
+	std::lock_guard<std::mutex> lck(_mtx);
+	size_t n = _samples.size();
+	_value.resize(n);
+	for (size_t i = 0; i < n; i++)
+		_value[i] = _samples[physical(i)];
+}
+
+std::vector<double> FloatSeriesValue::timestamps() const
+{
+	std::lock_guard<std::mutex> lck(_mtx);
+	size_t n = _stamps.size();
+	std::vector<double> ts(n);
+	for (size_t i = 0; i < n; i++)
+		ts[i] = _stamps[physical(i)];
+	return ts;
+}
+
+std::vector<double> FloatSeriesValue::since(uint64_t seq,
+                                            uint64_t& first) const
+{
+	std::lock_guard<std::mutex> lck(_mtx);
+	size_t n = _samples.size();
+	uint64_t oldest = _total - n;
+	if (seq < oldest) seq = oldest;
+	first = seq;
+
+	std::vector<double> pairs;
+	if (_total <= seq) return pairs;
+
+	pairs.reserve(2 * (_total - seq));
+	for (size_t i = seq - oldest; i < n; i++)
+	{
+		size_t p = physical(i);
+		pairs.push_back(_stamps[p]);
+		pairs.push_back(_samples[p]);
+	}
+	return pairs;
+}
+
+// ==============================================================
+
+/// Return the logical index of the first sample stamped at or
+/// after `t`. Caller must hold the lock.
+size_t FloatSeriesValue::lower_bound(double t) const
+{
+	size_t lo = 0;
+	size_t hi = _stamps.size();
+	while (lo < hi)
+	{
+		size_t mid = lo + (hi - lo) / 2;
+		if (_stamps[physical(mid)] < t) lo = mid + 1;
+		else hi = mid;
+	}
+	return lo;
+}
+
+FloatSeriesValuePtr FloatSeriesValue::range(double from, double to) const
+{
+	std::lock_guard<std::mutex> lck(_mtx);
+	size_t lo = lower_bound(from);
+	size_t hi = std::max(lo, lower_bound(to));
+
+	FloatSeriesValuePtr fsv(createFloatSeriesValue(std::max<size_t>(1, hi-lo)));
+	for (size_t i = lo; i < hi; i++)
+	{
+		size_t p = physical(i);
+		fsv->do_append(_stamps[p], _samples[p]);
+	}
+	return fsv;
+}
+
+FloatSeriesValuePtr FloatSeriesValue::downsample(double interval) const
+{
+	if (not (0.0 < interval))
+		throw InvalidParamException(TRACE_INFO,
+			"FloatSeriesValue: downsample interval must be positive");
+
+	std::vector<double> stamps;
+	std::vector<double> means;
+	{
+		std::lock_guard<std::mutex> lck(_mtx);
+		double bucket = 0.0;
+		double sum = 0.0;
+		size_t cnt = 0;
+		for (size_t i = 0; i < _samples.size(); i++)
+		{
+			size_t p = physical(i);
+			double b = std::floor(_stamps[p] / interval) * interval;
+			if (0 < cnt and b != bucket)
+			{
+				stamps.push_back(bucket);
+				means.push_back(sum / cnt);
+				sum = 0.0;
+				cnt = 0;
+			}
+			bucket = b;
+			sum += _samples[p];
+			cnt++;
+		}
+		if (0 < cnt)
+		{
+			stamps.push_back(bucket);
+			means.push_back(sum / cnt);
+		}
+	}
+
+	FloatSeriesValuePtr fsv(createFloatSeriesValue(
+		std::max<size_t>(1, means.size())));
+	fsv->append(stamps, means);
+	return fsv;
+}
+
+// ==============================================================
+
+bool FloatSeriesValue::operator==(const Value& other) const
+{
+	if (FLOAT_SERIES_VALUE != other.get_type()) return false;
+	if (this == &other) return true;
+
+	const FloatSeriesValue* fsv = (const FloatSeriesValue*) &other;
+	if (_capacity != fsv->_capacity) return false;
+	if (timestamps() != fsv->timestamps()) return false;
+
+	update();
+	fsv->update();
+	return FloatValue::operator==(other);
+}
+
+std::string FloatSeriesValue::to_string(const std::string& indent) const
+{
+	std::string rv = indent + "(" + nameserver().getTypeName(_type);
+	rv += " " + std::to_string(_capacity);
+
+	std::lock_guard<std::mutex> lck(_mtx);
+	rv += " " + std::to_string(_total);
+	for (size_t i = 0; i < _samples.size(); i++)
+	{
+		size_t p = physical(i);
+		char buf[80];
+		snprintf(buf, 80, " %.16g %.16g", _stamps[p], _samples[p]);
+		rv += buf;
+	}
+	rv += ")";
+	return rv;
+}
+
+// ==============================================================
+
+// Adds factory when library is loaded.
+DEFINE_VALUE_FACTORY(FLOAT_SERIES_VALUE,
+                     createFloatSeriesValue, std::vector<double>)
+DEFINE_VALUE_FACTORY(FLOAT_SERIES_VALUE,
+                     createFloatSeriesValue, size_t)
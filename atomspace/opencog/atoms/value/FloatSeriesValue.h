@@ -0,0 +1,138 @@
+/*
+ * opencog/atoms/value/FloatSeriesValue.h
+ *
+ * Copyright (C) 2026 OpenCog Foundation
+ * All Rights Reserved
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License v3 as
+ * published by the Free Software Foundation and including the exceptions
+ * at http://opencog.org/wiki/Licenses
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program; if not, write to:
+ * Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#ifndef _OPENCOG_FLOAT_SERIES_VALUE_H
+#define _OPENCOG_FLOAT_SERIES_VALUE_H
+
+#include <mutex>
+#include <opencog/atoms/value/FloatValue.h>
+
+namespace opencog
+{
+
+/** \addtogroup grp_atomspace
+ *  @{
+ */
+
+class FloatSeriesValue;
+typedef std::shared_ptr<FloatSeriesValue> FloatSeriesValuePtr;
+
+/**
+ * FloatSeriesValues hold a time series of floating-point samples.
+ * Each sample carries a timestamp (in seconds, typically since the
+ * epoch). The series is a ring buffer of fixed capacity: once full,
+ * each append overwrites the oldest sample. This allows a sensor
+ * reading to be hung on a single Atom/key pair, and updated many
+ * times a second, without churning Atoms or keys.
+ *
+ * Unlike most Values, a series is mutable, and appends are thread-safe.
+ * The value() method returns the samples currently held, oldest first;
+ * timestamps() returns the matching timestamps. Timestamps must be
+ * non-decreasing.
+ *
+ * Every sample ever appended gets a sequence number; total() is the
+ * sequence number of the next sample. Storage backends use this to
+ * write only the samples appended since the last store.
+ *
+ * The printed form is
+ *    (FloatSeriesValue capacity total t0 v0 t1 v1 ...)
+ * and the same vector can be passed to the constructor, so that the
+ * series round-trips through the s-expression codec.
+ */
+class FloatSeriesValue
+	: public FloatValue
+{
+protected:
+	mutable std::mutex _mtx;
+
+	size_t _capacity;
+	uint64_t _total;
+
+	// Ring buffer. Grows by push_back until full; after that, `_head`
+	// is the slot holding the oldest sample.
+	std::vector<double> _stamps;
+	std::vector<double> _samples;
+	size_t _head;
+
+	virtual void update() const;
+
+	void do_append(double, double);
+	size_t lower_bound(double) const;
+	size_t physical(size_t i) const
+		{ return (_head + i) % _samples.size(); }
+
+public:
+	FloatSeriesValue(size_t capacity);
+	FloatSeriesValue(const std::vector<double>&);
+	virtual ~FloatSeriesValue() {}
+
+	virtual bool is_mutable() const { return true; }
+
+	/// Append a sample, stamped with the current wall-clock time.
+	void append(double);
+
+	/// Append a sample with the given timestamp.
+	void append(double stamp, double sample);
+
+	/// Append a batch of samples, under a single lock.
+	void append(const std::vector<double>& stamps,
+	            const std::vector<double>& samples);
+
+	size_t capacity() const { return _capacity; }
+	uint64_t total() const;
+	size_t size() const;
+	std::vector<double> timestamps() const;
+
+	/// Return the samples (interleaved as t0 v0 t1 v1 ...) having
+	/// sequence number `seq` or later. The sequence number of the
+	/// first returned sample is placed in `first`.
+	std::vector<double> since(uint64_t seq, uint64_t& first) const;
+
+	/// Return a new series holding the samples whose timestamps lie
+	/// in the half-open interval [from, to).
+	FloatSeriesValuePtr range(double from, double to) const;
+
+	/// Return a new series holding the mean of the samples in each
+	/// time bucket of width `interval`. Buckets are aligned to
+	/// multiples of `interval`, and are stamped with their start time.
+	/// Empty buckets are omitted.
+	FloatSeriesValuePtr downsample(double interval) const;
+
+	/** Returns a string representation of the value. */
+	virtual std::string to_string(const std::string& indent = "") const;
+
+	/** Returns true if two values are equal. */
+	virtual bool operator==(const Value&) const;
+};
+
+static inline FloatSeriesValuePtr FloatSeriesValueCast(const ValuePtr& a)
+	{ return std::dynamic_pointer_cast<FloatSeriesValue>(a); }
+
+template<typename ... Type>
+static inline std::shared_ptr<FloatSeriesValue> createFloatSeriesValue(Type&&... args) {
+	return std::make_shared<FloatSeriesValue>(std::forward<Type>(args)...);
+}
+
+/** @}*/
+} // namespace opencog
+
+#endif // _OPENCOG_FLOAT_SERIES_VALUE_H
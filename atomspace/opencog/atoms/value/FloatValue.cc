@@ -20,6 +20,8 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
  */
 
+#include <algorithm>
+
 #include <opencog/util/exceptions.h>
 #include <opencog/atoms/value/FloatValue.h>
 #include <opencog/atoms/value/ValueFactory.h>
@@ -108,14 +110,85 @@ std::string FloatValue::to_string(const std::string& indent, Type t) const
 
 // ==============================================================
 
+// Each kernel below is built several times over, for AVX-512, for
+// AVX2, and for the baseline instruction set; the dynamic loader picks
+// the best one that the running CPU supports. The loops themselves are
+// plain C++, and are vectorized by the compiler. Elsewhere, there is
+// just the one, baseline version.
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && defined(__linux__)
+	#define VECTOR_CLONES __attribute__((target_clones("avx512f","avx2","default")))
+#else
+	#define VECTOR_CLONES
+#endif
+
+VECTOR_CLONES
+void opencog::plus(double* r, const double* a, const double* b, size_t n)
+{
+	for (size_t i=0; i<n; i++) r[i] = a[i] + b[i];
+}
+
+VECTOR_CLONES
+void opencog::minus(double* r, const double* a, const double* b, size_t n)
+{
+	for (size_t i=0; i<n; i++) r[i] = a[i] - b[i];
+}
+
+VECTOR_CLONES
+void opencog::times(double* r, const double* a, const double* b, size_t n)
+{
+	for (size_t i=0; i<n; i++) r[i] = a[i] * b[i];
+}
+
+VECTOR_CLONES
+void opencog::divide(double* r, const double* a, const double* b, size_t n)
+{
+	for (size_t i=0; i<n; i++) r[i] = a[i] / b[i];
+}
+
+VECTOR_CLONES
+void opencog::plus(double* r, double s, const double* b, size_t n)
+{
+	for (size_t i=0; i<n; i++) r[i] = s + b[i];
+}
+
+VECTOR_CLONES
+void opencog::minus(double* r, double s, const double* b, size_t n)
+{
+	for (size_t i=0; i<n; i++) r[i] = s - b[i];
+}
+
+VECTOR_CLONES
+void opencog::minus(double* r, const double* a, double s, size_t n)
+{
+	for (size_t i=0; i<n; i++) r[i] = a[i] - s;
+}
+
+VECTOR_CLONES
+void opencog::times(double* r, double s, const double* b, size_t n)
+{
+	for (size_t i=0; i<n; i++) r[i] = s * b[i];
+}
+
+VECTOR_CLONES
+void opencog::divide(double* r, double s, const double* b, size_t n)
+{
+	for (size_t i=0; i<n; i++) r[i] = s / b[i];
+}
+
+VECTOR_CLONES
+void opencog::divide(double* r, const double* a, double s, size_t n)
+{
+	for (size_t i=0; i<n; i++) r[i] = a[i] / s;
+}
+
+// ==============================================================
+
 /// Scalar addition
 std::vector<double> opencog::plus(double scalar, const std::vector<double>& fv)
 {
 	size_t len = fv.size();
 	std::vector<double> sum(len);
-	for (size_t i=0; i<len; i++)
-		sum[i] = scalar + fv[i];
-
+	plus(sum.data(), scalar, fv.data(), len);
 	return sum;
 }
 
@@ -124,9 +197,7 @@ std::vector<double> opencog::minus(double scalar, const std::vector<double>& fv)
 {
 	size_t len = fv.size();
 	std::vector<double> diff(len);
-	for (size_t i=0; i<len; i++)
-		diff[i] = scalar - fv[i];
-
+	minus(diff.data(), scalar, fv.data(), len);
 	return diff;
 }
 
@@ -134,9 +205,7 @@ std::vector<double> opencog::minus(const std::vector<double>& fv, double scalar)
 {
 	size_t len = fv.size();
 	std::vector<double> diff(len);
-	for (size_t i=0; i<len; i++)
-		diff[i] = fv[i] - scalar;
-
+	minus(diff.data(), fv.data(), scalar, len);
 	return diff;
 }
 
@@ -145,9 +214,7 @@ std::vector<double> opencog::times(double scalar, const std::vector<double>& fv)
 {
 	size_t len = fv.size();
 	std::vector<double> prod(len);
-	for (size_t i=0; i<len; i++)
-		prod[i] = scalar * fv[i];
-
+	times(prod.data(), scalar, fv.data(), len);
 	return prod;
 }
 
@@ -156,9 +223,7 @@ std::vector<double> opencog::divide(double scalar, const std::vector<double>& fv
 {
 	size_t len = fv.size();
 	std::vector<double> ratio(len);
-	for (size_t i=0; i<len; i++)
-		ratio[i] = scalar / fv[i];
-
+	divide(ratio.data(), scalar, fv.data(), len);
 	return ratio;
 }
 
@@ -177,22 +242,11 @@ std::vector<double> opencog::plus(const std::vector<double>& fva,
 		return plus(fvb[0], fva);
 
 	std::vector<double> sum(std::max(lena, lenb));
-	if (lena < lenb)
-	{
-		size_t i=0;
-		for (; i<lena; i++)
-			sum[i] = fva[i] + fvb[i];
-		for (; i<lenb; i++)
-			sum[i] = fvb[i];
-	}
-	else
-	{
-		size_t i=0;
-		for (; i<lenb; i++)
-			sum[i] = fva[i] + fvb[i];
-		for (; i<lena; i++)
-			sum[i] = fva[i];
-	}
+	size_t len = std::min(lena, lenb);
+	plus(sum.data(), fva.data(), fvb.data(), len);
+
+	const std::vector<double>& rest = (lena < lenb) ? fvb : fva;
+	std::copy(rest.begin() + len, rest.end(), sum.begin() + len);
 	return sum;
 }
 
@@ -211,22 +265,13 @@ std::vector<double> opencog::minus(const std::vector<double>& fva,
 		return minus(fva, fvb[0]);
 
 	std::vector<double> diff(std::max(lena, lenb));
-	if (lena < lenb)
-	{
-		size_t i=0;
-		for (; i<lena; i++)
-			diff[i] = fva[i] - fvb[i];
-		for (; i<lenb; i++)
-			diff[i] = -fvb[i];
-	}
-	else
-	{
-		size_t i=0;
-		for (; i<lenb; i++)
-			diff[i] = fva[i] - fvb[i];
-		for (; i<lena; i++)
-			diff[i] = fva[i];
-	}
+	size_t len = std::min(lena, lenb);
+	minus(diff.data(), fva.data(), fvb.data(), len);
+
+	for (size_t i=len; i<lenb; i++)
+		diff[i] = -fvb[i];
+	for (size_t i=len; i<lena; i++)
+		diff[i] = fva[i];
 	return diff;
 }
 
@@ -243,37 +288,18 @@ std::vector<double> opencog::times(const std::vector<double>& fva,
 	size_t lena = fva.size();
 	size_t lenb = fvb.size();
 
-	std::vector<double> prod(std::max(lena, lenb));
 	if (1 == lena)
-	{
-		double f = fva[0];
-		for (size_t i=0; i<lenb; i++)
-			prod[i] = f * fvb[i];
-	}
-	else
+		return times(fva[0], fvb);
+
 	if (1 == lenb)
-	{
-		double f = fvb[0];
-		for (size_t i=0; i<lena; i++)
-			prod[i] = f * fva[i];
-	}
-	else
-	if (lena < lenb)
-	{
-		size_t i=0;
-		for (; i<lena; i++)
-			prod[i] = fva[i] * fvb[i];
-		for (; i<lenb; i++)
-			prod[i] = fvb[i];
-	}
-	else
-	{
-		size_t i=0;
-		for (; i<lenb; i++)
-			prod[i] = fva[i] * fvb[i];
-		for (; i<lena; i++)
-			prod[i] = fva[i];
-	}
+		return times(fvb[0], fva);
+
+	std::vector<double> prod(std::max(lena, lenb));
+	size_t len = std::min(lena, lenb);
+	times(prod.data(), fva.data(), fvb.data(), len);
+
+	const std::vector<double>& rest = (lena < lenb) ? fvb : fva;
+	std::copy(rest.begin() + len, rest.end(), prod.begin() + len);
 	return prod;
 }
 
@@ -287,37 +313,23 @@ std::vector<double> opencog::divide(const std::vector<double>& fva,
 	size_t lena = fva.size();
 	size_t lenb = fvb.size();
 
-	std::vector<double> ratio(std::max(lena, lenb));
 	if (1 == lena)
-	{
-		double f = fva[0];
-		for (size_t i=0; i<lenb; i++)
-			ratio[i] = f / fvb[i];
-	}
-	else
+		return divide(fva[0], fvb);
+
+	std::vector<double> ratio(std::max(lena, lenb));
 	if (1 == lenb)
 	{
-		double f = fvb[0];
-		for (size_t i=0; i<lena; i++)
-			ratio[i] = fva[i] / f;
-	}
-	else
-	if (lena < lenb)
-	{
-		size_t i=0;
-		for (; i<lena; i++)
-			ratio[i] = fva[i] / fvb[i];
-		for (; i<lenb; i++)
-			ratio[i] = 1.0 / fvb[i];
-	}
-	else
-	{
-		size_t i=0;
-		for (; i<lenb; i++)
-			ratio[i] = fva[i] / fvb[i];
-		for (; i<lena; i++)
-			ratio[i] = fva[i];
+		divide(ratio.data(), fva.data(), fvb[0], lena);
+		return ratio;
 	}
+
+	size_t len = std::min(lena, lenb);
+	divide(ratio.data(), fva.data(), fvb.data(), len);
+
+	for (size_t i=len; i<lenb; i++)
+		ratio[i] = 1.0 / fvb[i];
+	for (size_t i=len; i<lena; i++)
+		ratio[i] = fva[i];
 	return ratio;
 }
 
@@ -60,6 +60,8 @@ public:
 
 	const std::vector<double>& value() const { update(); return _value; }
 	size_t size() const { return _value.size(); }
+	virtual size_t footprint() const
+		{ return sizeof(FloatValue) + _value.capacity() * sizeof(double); }
 	virtual ValuePtr value_at_index(size_t) const;
 	virtual ValuePtr incrementCount(const std::vector<double>&) const;
 	virtual ValuePtr incrementCount(size_t, double) const;
@@ -121,6 +123,23 @@ std::vector<double> minus(const std::vector<double>&, const std::vector<double>&
 std::vector<double> times(const std::vector<double>&, const std::vector<double>&);
 std::vector<double> divide(const std::vector<double>&, const std::vector<double>&);
 
+/// Point-wise kernels on raw arrays of length `n`. The scalar `s` is
+/// applied to every element. The result `r` may be the same array as
+/// `a` or `b`. These are vectorized, with the instruction set picked
+/// at run time; the functions above, and the compiled formulas in
+/// atoms/reduct, are built on them.
+void plus(double* r, const double* a, const double* b, size_t n);
+void minus(double* r, const double* a, const double* b, size_t n);
+void times(double* r, const double* a, const double* b, size_t n);
+void divide(double* r, const double* a, const double* b, size_t n);
+
+void plus(double* r, double s, const double* b, size_t n);
+void minus(double* r, double s, const double* b, size_t n);
+void minus(double* r, const double* a, double s, size_t n);
+void times(double* r, double s, const double* b, size_t n);
+void divide(double* r, double s, const double* b, size_t n);
+void divide(double* r, const double* a, double s, size_t n);
+
 /// Vector multiplication and addition. When operating on an object
 /// times itself, take a sample first; this is needed to correctly
 /// handle streaming values, as they issue new values every time
@@ -97,8 +97,28 @@ void FormulaStream::init(void)
 
 // ==============================================================
 
+void FormulaStream::memoize(double max_age)
+{
+	std::lock_guard<std::mutex> lck(_mtx);
+	_memoize = true;
+	_max_age = max_age;
+	_reads.clear();
+}
+
 // XXX FIXME The update here is not thread-safe...
 void FormulaStream::update() const
+{
+	if (not _memoize) { compute(); return; }
+
+	// The lock is held while computing, so that two threads do not
+	// both record into the same log.
+	std::lock_guard<std::mutex> lck(_mtx);
+	if (not _reads.stale(_max_age)) return;
+	ValueReadLog::Recorder rec(_reads);
+	compute();
+}
+
+void FormulaStream::compute() const
 {
 	if (1 == _formula.size())
 	{
@@ -23,9 +23,11 @@
 #ifndef _OPENCOG_FORMULA_STREAM_H
 #define _OPENCOG_FORMULA_STREAM_H
 
+#include <mutex>
 #include <vector>
 #include <opencog/atoms/value/StreamValue.h>
 #include <opencog/atoms/base/Handle.h>
+#include <opencog/atoms/base/ValueReadLog.h>
 #include <opencog/atomspace/AtomSpace.h>
 
 namespace opencog
@@ -47,15 +49,31 @@ protected:
 
 	void init(void);
 	virtual void update() const;
+	void compute() const;
 	HandleSeq _formula;
 	AtomSpace* _as;
 
+	bool _memoize = false;
+	double _max_age = 0.0;
+	mutable ValueReadLog _reads;
+	mutable std::mutex _mtx;
+
 public:
 	FormulaStream(const Handle&);
 	FormulaStream(const HandleSeq&&);
 	FormulaStream(const ValueSeq&);
 	virtual ~FormulaStream() {}
 
+	/**
+	 * Keep the last result, until one of the values that the formula
+	 * read changes, or until it is more than `max_age` seconds old.
+	 * A `max_age` of zero means no limit. Only the values read with
+	 * getValue() are watched; a formula that depends on anything else
+	 * (a grounded function, the contents of the AtomSpace) should give
+	 * a `max_age`. See ValueReadLog.
+	 */
+	void memoize(double max_age = 0.0);
+
 	/** Returns a string representation of the value.  */
 	virtual std::string to_string(const std::string& indent = "") const;
 
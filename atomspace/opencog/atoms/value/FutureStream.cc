@@ -90,7 +90,27 @@ void FutureStream::init(void)
 
 // ==============================================================
 
+void FutureStream::memoize(double max_age)
+{
+	std::lock_guard<std::mutex> lck(_mtx);
+	_memoize = true;
+	_max_age = max_age;
+	_reads.clear();
+}
+
 void FutureStream::update() const
+{
+	if (not _memoize) { compute(); return; }
+
+	// The lock is held while computing, so that two threads do not
+	// both record into the same log.
+	std::lock_guard<std::mutex> lck(_mtx);
+	if (not _reads.stale(_max_age)) return;
+	ValueReadLog::Recorder rec(_reads);
+	compute();
+}
+
+void FutureStream::compute() const
 {
 	std::vector<ValuePtr> newval;
 	for (const Handle& h : _formula)
@@ -23,7 +23,10 @@
 #ifndef _OPENCOG_FUTURE_STREAM_H
 #define _OPENCOG_FUTURE_STREAM_H
 
+#include <mutex>
+
 #include <opencog/atoms/base/Handle.h>
+#include <opencog/atoms/base/ValueReadLog.h>
 #include <opencog/atomspace/AtomSpace.h>
 #include <opencog/atoms/value/LinkStreamValue.h>
 
@@ -46,15 +49,27 @@ protected:
 
 	void init(void);
 	virtual void update() const;
+	void compute() const;
 	HandleSeq _formula;
 	AtomSpace* _as;
 
+	bool _memoize = false;
+	double _max_age = 0.0;
+	mutable ValueReadLog _reads;
+	mutable std::mutex _mtx;
+
 public:
 	FutureStream(const Handle&);
 	FutureStream(const HandleSeq&&);
 	FutureStream(const ValueSeq&);
 	virtual ~FutureStream() {}
 
+	/**
+	 * Keep the last results until a value read by the formulas
+	 * changes; as in FormulaStream::memoize().
+	 */
+	void memoize(double max_age = 0.0);
+
 	/** Returns a string representation of the value.  */
 	virtual std::string to_string(const std::string& indent = "") const;
 
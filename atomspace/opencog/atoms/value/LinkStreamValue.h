@@ -46,6 +46,8 @@ protected:
 public:
 	virtual ~LinkStreamValue() {}
 
+	virtual bool is_mutable() const { return true; }
+
 	/** Returns true if two atoms are equal.  */
 	virtual bool operator==(const Value&) const;
 };
@@ -74,6 +74,15 @@ ValuePtr LinkValue::value_at_index(size_t idx) const
 	return createLinkValue(vp);
 }
 
+size_t LinkValue::footprint() const
+{
+	size_t sz = sizeof(LinkValue) + _value.capacity() * sizeof(ValuePtr);
+	for (const ValuePtr& v : _value)
+		if (not v->is_atom())
+			sz += v->footprint();
+	return sz;
+}
+
 // ==============================================================
 
 bool LinkValue::operator==(const Value& other) const
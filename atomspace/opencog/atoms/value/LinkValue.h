@@ -98,6 +98,7 @@ public:
 	HandleSeq to_handle_seq(void) const;
 	HandleSet to_handle_set(void) const;
 	size_t size() const { return _value.size(); }
+	virtual size_t footprint() const;
 	ValuePtr value_at_index(size_t) const;
 
 	/** Returns a string representation of the value.  */
@@ -20,20 +20,22 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
  */
 
+#include <algorithm>
+
 #include <opencog/atoms/value/QueueValue.h>
 #include <opencog/atoms/value/ValueFactory.h>
 
 using namespace opencog;
 
-typedef concurrent_queue<ValuePtr> conq;
+typedef concurrent_ring<ValuePtr> conq;
 
 // ==============================================================
 
 QueueValue::QueueValue(const ValueSeq& vseq)
-	: ContainerValue(QUEUE_VALUE)
+	: ContainerValue(QUEUE_VALUE),
+	  conq(std::max(RING_SIZE, vseq.size()), true)
 {
-	for (const ValuePtr& v: vseq)
-		push(v); // concurrent_queue<ValuePtr>::push(v);
+	conq::push_batch(vseq.begin(), vseq.end());
 
 	// Since this constructor placed stuff on the queue,
 	// we also close it, to indicate we are "done" placing
@@ -116,7 +118,7 @@ void QueueValue::add(const ValuePtr& vp)
 
 void QueueValue::add(ValuePtr&& vp)
 {
-	conq::push(vp);
+	conq::push(std::move(vp));
 }
 
 ValuePtr QueueValue::remove(void)
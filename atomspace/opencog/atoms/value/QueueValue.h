@@ -23,7 +23,7 @@
 #ifndef _OPENCOG_QUEUE_VALUE_H
 #define _OPENCOG_QUEUE_VALUE_H
 
-#include <opencog/util/concurrent_queue.h>
+#include <opencog/util/concurrent_ring.h>
 #include <opencog/atoms/value/ContainerValue.h>
 #include <opencog/atoms/atom_types/atom_types.h>
 
@@ -38,16 +38,36 @@ namespace opencog
  * QueueValues provide a thread-safe FIFO queue of Values. They are
  * meant to be used for producer-consumer APIs, where the produced
  * values are to be handled in sequential order, in a different thread.
+ *
+ * The queue is a lock-free ring, so that many producer threads can
+ * push at once without contending on a mutex. It spills onto an
+ * unbounded list when full: many users fill the queue completely
+ * before anyone reads it, and so the producers must never block.
+ * While anything is spilled, every push takes the list's mutex, so
+ * the ring should be big enough that it does not fill under the
+ * expected load. By default, it has RING_SIZE slots, which is room
+ * for dozens of producers to get well ahead of a consumer; use sites
+ * that know their load can pass a capacity instead. A queue that is
+ * constructed with values is big enough to hold them. The list is
+ * only allocated if the ring spills.
  */
 class QueueValue
-	: public ContainerValue, protected concurrent_queue<ValuePtr>
+	: public ContainerValue, protected concurrent_ring<ValuePtr>
 {
 protected:
-	QueueValue(Type t) : ContainerValue(t) {}
+	static constexpr size_t RING_SIZE = 1024;
+
+	QueueValue(Type t)
+		: ContainerValue(t), concurrent_ring<ValuePtr>(RING_SIZE, true) {}
 	virtual void update() const;
 
 public:
-	QueueValue(void) : ContainerValue(QUEUE_VALUE) {}
+	QueueValue(void)
+		: ContainerValue(QUEUE_VALUE),
+		  concurrent_ring<ValuePtr>(RING_SIZE, true) {}
+	explicit QueueValue(size_t capacity)
+		: ContainerValue(QUEUE_VALUE),
+		  concurrent_ring<ValuePtr>(capacity, true) {}
 	QueueValue(const ValueSeq&);
 	virtual ~QueueValue() {}
 	virtual void open(void);
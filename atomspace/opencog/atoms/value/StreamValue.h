@@ -56,6 +56,8 @@ protected:
 public:
 	virtual ~StreamValue() {}
 
+	virtual bool is_mutable() const { return true; }
+
 	/** Returns true if two atoms are equal.  */
 	virtual bool operator==(const Value&) const;
 };
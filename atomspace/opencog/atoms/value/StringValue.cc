@@ -48,6 +48,21 @@ bool StringValue::operator==(const Value& other) const
 	return true;
 }
 
+size_t StringValue::footprint() const
+{
+	size_t sz = sizeof(StringValue) + _value.capacity() * sizeof(std::string);
+
+	// Short strings live inside the std::string itself.
+	for (const std::string& s : _value)
+	{
+		const char* p = s.data();
+		const char* o = (const char*) &s;
+		if (p < o or o + sizeof(std::string) <= p)
+			sz += s.capacity() + 1;
+	}
+	return sz;
+}
+
 // ==============================================================
 
 /// Print the StringValue. Escape any quotes in the strings when
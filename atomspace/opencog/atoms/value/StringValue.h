@@ -51,6 +51,8 @@ public:
 		: Value(STRING_VALUE) { _value.push_back(v); }
 	StringValue(const std::vector<std::string>& v)
 		: Value(STRING_VALUE), _value(v) {}
+	StringValue(std::vector<std::string>&& v)
+		: Value(STRING_VALUE), _value(std::move(v)) {}
 	StringValue(Type t, const std::vector<std::string>& v)
 		: Value(t), _value(v) {}
 
@@ -58,6 +60,7 @@ public:
 
 	const std::vector<std::string>& value() const { return _value; }
 	size_t size() const {return _value.size(); }
+	virtual size_t footprint() const;
 	ValuePtr value_at_index(size_t) const;
 
 	/** Returns a string representation of the value.  */
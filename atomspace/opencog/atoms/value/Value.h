@@ -64,6 +64,15 @@ public:
 	virtual bool is_link() const { return false; }
 	virtual bool is_unordered_link() const { return false; }
 	virtual size_t size() const { return 0; }
+
+	/// True if the contents can change without the Value being
+	/// replaced, as for streams and series. Most Values are immutable.
+	virtual bool is_mutable() const { return false; }
+
+	/// Approximate number of bytes of RAM used by this Value: the
+	/// object itself plus whatever it holds on the heap. Atoms that
+	/// it refers to are not included.
+	virtual size_t footprint() const { return sizeof(Value); }
 	virtual ValuePtr value_at_index(size_t) const = 0;
 
 	/** Basic predicate */
@@ -374,8 +374,65 @@ Handle AtomSpace::add_atom(const Handle& h)
     return rh;
 }
 
+// Most adds and gets are for atoms that are already in the atomspace.
+// Looking those up by building a full Atom first costs a heap
+// allocation, a run of the factory, and the type checking, all of it
+// only to be thrown away. Instead, the lookup is done with a probe
+// atom that lives on the stack: it has the same content hash and the
+// same notion of equality as the real thing, and so finds it in the
+// TypeIndex. The name, or outgoing set, is borrowed by the probe, and
+// handed back if it turns out that a real atom must be made after all.
+//
+// Types with a factory are not probed; the factory may rewrite the
+// atom into something else (e.g. a NumberNode canonicalizes its name,
+// a ScopeLink hashes alpha-equivalently), and only the factory knows.
+// Neither are types with a validator, so that a malformed atom is
+// still reported as such, whether or not it is found.
+namespace {
+
+class NodeProbe : public Node
+{
+public:
+    NodeProbe(Type t, std::string&& name) : Node(t, std::move(name)) {}
+    std::string&& release() { return std::move(_name); }
+};
+
+class LinkProbe : public Link
+{
+public:
+    LinkProbe(Type t, HandleSeq&& oset) : Link(std::move(oset), t) {}
+    HandleSeq&& release() { return std::move(_outgoing); }
+};
+
+// A Handle that does not own the atom it points at.
+inline Handle probe_handle(Atom* a)
+{
+    return Handle(AtomPtr(AtomPtr(), a));
+}
+
+}; // anonymous namespace
+
+/// Return the atom that `add()` would return for `probe`, if it is
+/// already in this frame and visible; else return null. Anything else
+/// (hidden atoms, atoms in deeper frames) is left for `add()` to sort
+/// out.
+Handle AtomSpace::lookup_present(const Handle& probe) const
+{
+    const Handle& h(typeIndex.findAtom(probe));
+    if (h and not h->isAbsent()) return h;
+    return Handle::UNDEFINED;
+}
+
 Handle AtomSpace::add_node(Type t, std::string&& name)
 {
+    if (classserver().isPlain(t)) {
+        NodeProbe probe(t, std::move(name));
+        Handle ph(probe_handle(&probe));
+        const Handle& h(_read_only ? lookupHandle(ph) : lookup_present(ph));
+        if (h or _read_only) return h;
+        name = probe.release();
+    }
+
     // Cannot add atoms to a read-only atomspace. But if it's already
     // in the atomspace, return it.
     if (_read_only)
@@ -386,11 +443,23 @@ Handle AtomSpace::add_node(Type t, std::string&& name)
 
 Handle AtomSpace::get_node(Type t, std::string&& name) const
 {
+    if (classserver().isPlain(t)) {
+        NodeProbe probe(t, std::move(name));
+        return lookupHandle(probe_handle(&probe));
+    }
     return lookupHandle(createNode(t, std::move(name)));
 }
 
 Handle AtomSpace::add_link(Type t, HandleSeq&& outgoing)
 {
+    if (classserver().isPlain(t)) {
+        LinkProbe probe(t, std::move(outgoing));
+        Handle ph(probe_handle(&probe));
+        const Handle& h(_read_only ? lookupHandle(ph) : lookup_present(ph));
+        if (h or _read_only) return h;
+        outgoing = probe.release();
+    }
+
     // Cannot add atoms to a read-only atomspace. But if it's already
     // in the atomspace, return it.
     if (_read_only)
@@ -417,6 +486,10 @@ Handle AtomSpace::add_link(Type t, HandleSeq&& outgoing)
 
 Handle AtomSpace::get_link(Type t, HandleSeq&& outgoing) const
 {
+    if (classserver().isPlain(t)) {
+        LinkProbe probe(t, std::move(outgoing));
+        return lookupHandle(probe_handle(&probe));
+    }
     return lookupHandle(createLink(std::move(outgoing), t));
 }
 
@@ -443,6 +516,109 @@ ValuePtr AtomSpace::add_atoms(const ValuePtr& vptr)
     return vptr;
 }
 
+namespace {
+
+// True if h, or any atom below it, is in the pending set. Shared
+// subtrees are only walked once.
+bool pends_on(const Handle& h, const UnorderedHandleSet& pending,
+              UnorderedHandleSet& seen)
+{
+    if (0 < pending.count(h)) return true;
+    if (not h->is_link() or not seen.insert(h).second) return false;
+    for (const Handle& ho : h->getOutgoingSet())
+        if (pends_on(ho, pending, seen)) return true;
+    return false;
+}
+
+}; // anonymous namespace
+
+HandleSeq AtomSpace::add_atoms(HandleSeq&& hseq)
+{
+    HandleSeq result(hseq.size());
+
+    // Cannot add atoms to a read-only atomspace. But if they're
+    // already in the atomspace, return them.
+    if (_read_only)
+    {
+        for (size_t i = 0; i < hseq.size(); i++)
+        {
+            if (nullptr == hseq[i]) continue;
+            result[i] = get_atom(hseq[i]); // Null, if not found.
+        }
+        return result;
+    }
+
+    // Atoms that are installed, but not yet visible in the index.
+    HandleSeq pending;
+    std::vector<size_t> pending_idx;
+    UnorderedHandleSet pending_set;
+
+    auto flush = [&]()
+    {
+        if (pending.empty()) return;
+
+        HandleSeq inserted(pending);
+        typeIndex.insertAtoms(inserted);
+        for (size_t j = 0; j < pending.size(); j++)
+        {
+            // Some other thread raced and inserted this atom already.
+            // Undo the install, just like add() does.
+            if (inserted[j] != pending[j])
+            {
+                pending[j]->setAtomSpace(nullptr);
+                pending[j]->remove();
+            }
+            else if (_change_feed.active())
+                _change_feed.publish(AtomEvent::ADDED, pending[j]);
+            result[pending_idx[j]] = inserted[j];
+        }
+        pending.clear();
+        pending_idx.clear();
+        pending_set.clear();
+    };
+
+    for (size_t i = 0; i < hseq.size(); i++)
+    {
+        const Handle& h = hseq[i];
+        if (nullptr == h) continue;
+
+        // If this atom, or anything below it, at any depth, is still
+        // pending, then the pending atoms must become visible first.
+        // Otherwise, prepare_add() would add them a second time, as it
+        // walks down the outgoing set. Flushing everything that came
+        // earlier keeps the batch in topological order.
+        if (not pending_set.empty())
+        {
+            UnorderedHandleSet seen;
+            if (pends_on(h, pending_set, seen)) flush();
+        }
+
+        // Same exception handling as in add_atom(), above.
+        try
+        {
+            bool present = false;
+            Handle atom(prepare_add(h, false, false, false, present));
+            if (present or nullptr == atom)
+            {
+                result[i] = atom;
+                continue;
+            }
+            install_atom(atom);
+            pending.push_back(atom);
+            pending_idx.push_back(i);
+            pending_set.insert(atom);
+        }
+        catch (const DeleteException& ex) {}
+        catch (const SilentException& ex)
+        {
+            result[i] = lookupHide(h, false);
+        }
+    }
+    flush();
+
+    return result;
+}
+
 // COW == Copy On Write
 #define COWBOY_CODE(DO_STUFF)                                            \
     AtomSpace* has = h->getAtomSpace();                                  \
@@ -35,7 +35,9 @@
 #include <opencog/atoms/base/Atom.h>
 #include <opencog/atoms/truthvalue/TruthValue.h>
 
+#include <opencog/atomspace/ChangeFeed.h>
 #include <opencog/atomspace/Frame.h>
+#include <opencog/atomspace/MemoryUsage.h>
 #include <opencog/atomspace/TypeIndex.h>
 
 class AtomTableUTest;
@@ -75,6 +77,9 @@ class AtomSpace : public Frame
     //! Index of atoms.
     TypeIndex typeIndex;
 
+    //! Subscribers to changes made to this AtomSpace.
+    ChangeFeed _change_feed;
+
     UUID _uuid;
     bool _read_only;
     bool _copy_on_write;
@@ -112,8 +117,19 @@ class AtomSpace : public Frame
      */
     Handle add(const Handle&, bool force=false,
                bool recurse=false, bool absent = false);
+
+    /**
+     * The two halves of add(). The first finds an existing atom, or
+     * builds one that is ready for insertion; `present` is set if the
+     * returned atom is already in the AtomSpace. The second makes the
+     * new atom ready to become visible in the index.
+     */
+    Handle prepare_add(const Handle&, bool force, bool recurse,
+                       bool absent, bool& present);
+    void install_atom(const Handle&);
     Handle check(const Handle&, bool force=false);
     Handle lookupHide(const Handle&, bool hide=false) const;
+    Handle lookup_present(const Handle&) const;
 
     virtual ContentHash compute_hash() const;
 
@@ -345,6 +361,17 @@ public:
      */
     ValuePtr add_atoms(const ValuePtr&);
 
+    /**
+     * Add a batch of atoms. This is the same as calling add_atom()
+     * on each of them, in order, except that the index lock is taken
+     * once per batch, instead of once per atom. Atoms may refer to
+     * atoms earlier in the same batch, at any depth. On a read-only
+     * atomspace, only the atoms it already has are returned; the rest
+     * are null. Returns the atomspace versions of the atoms, in the
+     * same order.
+     */
+    HandleSeq add_atoms(HandleSeq&&);
+
     /**
      * Get an atom from the AtomSpace. If the atom is not there, then
      * return Handle::UNDEFINED.
@@ -514,6 +541,76 @@ public:
                          bool parent=true,
                          const AtomSpace* = nullptr) const;
 
+    /**
+     * Return a consistent, read-only snapshot of the Atoms held in
+     * this AtomSpace. Only this AtomSpace is included; Atoms in the
+     * environment (in base frames) are not. Taking the snapshot is
+     * cheap; no Atoms are copied. Iterating over it does not need any
+     * locks, and does not block other threads that are adding or
+     * removing Atoms.
+     *
+     * Example:
+     * @code
+     *         auto snap = atomSpace.get_snapshot();
+     *         snap.foreach_atom(NODE, true, [](const Handle& h) {...});
+     * @endcode
+     */
+    TypeIndex::Snapshot get_snapshot(void) const
+    {
+        return typeIndex.snapshot();
+    }
+
+    /**
+     * Estimate the RAM used by the Atoms in this AtomSpace: per Atom
+     * type, per Value key, and for the incoming sets. Also list the
+     * `top_n` Atoms with the largest incoming sets. Only this
+     * AtomSpace is included, not the base frames.
+     *
+     * This visits every Atom. For very large AtomSpaces, pass a
+     * `sample` greater than one, to look at only one Atom out of
+     * that many, and scale up the result.
+     */
+    MemoryUsage get_memory_usage(size_t top_n = 10, size_t sample = 1) const;
+
+    /**
+     * Subscribe to a feed of the changes made to this AtomSpace:
+     * Atoms being added or extracted, and Values being set on Atoms.
+     * Only changes to this AtomSpace are reported, not those made in
+     * base frames. Clearing the whole AtomSpace is not reported.
+     *
+     * The subscriber is a bounded ring buffer holding `capacity`
+     * events; it should be drained regularly. If it fills up, further
+     * events are dropped, and counted by ChangeSubscriber::dropped().
+     * When there are no subscribers, there is no overhead.
+     *
+     * Example:
+     * @code
+     *         ChangeSubscriberPtr sub = atomSpace.subscribe_changes();
+     *         std::vector<AtomEvent> batch;
+     *         sub->drain(batch);
+     *         for (const AtomEvent& ev : batch) {...}
+     *         atomSpace.unsubscribe_changes(sub);
+     * @endcode
+     */
+    ChangeSubscriberPtr subscribe_changes(size_t capacity = 4096)
+    {
+        return _change_feed.subscribe(capacity);
+    }
+
+    void unsubscribe_changes(const ChangeSubscriberPtr& sub)
+    {
+        _change_feed.unsubscribe(sub);
+    }
+
+    /// Called by Atoms, when a Value on them changes.
+    void value_changed(const Atom* atom, const Handle& key,
+                       const ValuePtr& value)
+    {
+        if (not _change_feed.active()) return;
+        _change_feed.publish(AtomEvent::VALUE_SET,
+                             atom->get_handle(), key, value);
+    }
+
     /** Returns a string representation of the AtomSpace. */
     virtual std::string to_string(void) const;
     virtual std::string to_string(const std::string& indent) const;
@@ -295,6 +295,35 @@ Handle AtomSpace::check(const Handle& orig, bool force)
 Handle AtomSpace::add(const Handle& orig, bool force,
                       bool recurse, bool absent)
 {
+    bool present = false;
+    Handle atom(prepare_add(orig, force, recurse, absent, present));
+    if (present or nullptr == atom) return atom;
+
+    install_atom(atom);
+
+    // Between the time that we last checked, and here, some other thread
+    // may have raced and inserted this atom already. So the insert does
+    // have to be an atomic test-n-set.
+    const Handle& oldh(typeIndex.insertAtom(atom));
+    if (oldh)
+    {
+        // If it was already in the index, then undo the install above.
+        atom->setAtomSpace(nullptr);
+        atom->remove();
+        return oldh;
+    }
+
+    // Atoms added only to hide others are reported by extract_atom().
+    if (not absent and _change_feed.active())
+        _change_feed.publish(AtomEvent::ADDED, atom);
+    return atom;
+}
+
+Handle AtomSpace::prepare_add(const Handle& orig, bool force,
+                              bool recurse, bool absent, bool& present)
+{
+    present = true;
+
     // Can be null, if its a Value
     if (nullptr == orig) return Handle::UNDEFINED;
 
@@ -383,6 +412,12 @@ Handle AtomSpace::add(const Handle& orig, bool force,
     if (atom != orig)
         atom->copyValues(orig);
 
+    present = false;
+    return atom;
+}
+
+void AtomSpace::install_atom(const Handle& atom)
+{
     // Must set atomspace before insertion. This must be done before the
     // atom becomes visible at the typeIndex insert.  Likewise for setting
     // up the incoming set.
@@ -396,19 +431,6 @@ Handle AtomSpace::add(const Handle& orig, bool force,
     // that the incoming set hash bucket hasn't yet been created even
     // as the atom is being deleted.
     atom->install();
-
-    // Between the time that we last checked, and here, some other thread
-    // may have raced and inserted this atom already. So the insert does
-    // have to be an atomic test-n-set.
-    const Handle& oldh(typeIndex.insertAtom(atom));
-    if (oldh)
-    {
-        // If it was already in the index, then undo the install above.
-        atom->setAtomSpace(nullptr);
-        atom->remove();
-        return oldh;
-    }
-    return atom;
 }
 
 void AtomSpace::barrier()
@@ -497,6 +519,8 @@ bool AtomSpace::extract_atom(const Handle& h, bool recursive)
         // If we are here, then mask.
         const Handle& hide(add(handle, true, true, true));
         hide->setAbsent();
+        if (_change_feed.active())
+            _change_feed.publish(AtomEvent::EXTRACTED, handle);
         return true;
     }
 
@@ -518,6 +542,8 @@ bool AtomSpace::extract_atom(const Handle& h, bool recursive)
         if (_copy_on_write) {
             const Handle& hide(add(handle, true, true, true));
             hide->setAbsent();
+            if (_change_feed.active())
+                _change_feed.publish(AtomEvent::EXTRACTED, handle);
             return true;
         }
 
@@ -536,6 +562,8 @@ bool AtomSpace::extract_atom(const Handle& h, bool recursive)
             {
                 const Handle& hide(add(handle, true, true, true));
                 hide->setAbsent();
+                if (_change_feed.active())
+                    _change_feed.publish(AtomEvent::EXTRACTED, handle);
                 return true;
             }
         }
@@ -572,6 +600,9 @@ bool AtomSpace::extract_atom(const Handle& h, bool recursive)
     handle->remove();
     handle->setAtomSpace(nullptr);
 
+    if (_change_feed.active())
+        _change_feed.publish(AtomEvent::EXTRACTED, handle);
+
     return true;
 }
 
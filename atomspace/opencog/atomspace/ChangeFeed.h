@@ -0,0 +1,239 @@
+/*
+ * opencog/atomspace/ChangeFeed.h
+ *
+ * Copyright (C) 2026 OpenCog Foundation
+ * All Rights Reserved
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License v3 as
+ * published by the Free Software Foundation and including the exceptions
+ * at http://opencog.org/wiki/Licenses
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program; if not, write to:
+ * Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#ifndef _OPENCOG_CHANGE_FEED_H
+#define _OPENCOG_CHANGE_FEED_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <opencog/atoms/base/Handle.h>
+#include <opencog/atoms/value/Value.h>
+
+namespace opencog
+{
+/** \addtogroup grp_atomspace
+ *  @{
+ */
+
+/**
+ * A single change made to an AtomSpace. For VALUE_SET events, `key`
+ * and `value` hold the key and the new value; a null value means that
+ * the key was removed. For the other events, they are empty.
+ */
+struct AtomEvent
+{
+	enum Kind { ADDED, EXTRACTED, VALUE_SET };
+
+	Kind kind;
+	Handle atom;
+	Handle key;
+	ValuePtr value;
+};
+
+/**
+ * A bounded, lock-free queue of AtomEvents, one per subscriber.
+ *
+ * The AtomSpace pushes into it from whatever threads are making
+ * changes; the subscriber drains it, in batches, at its own pace.
+ * Pushing never blocks: if the subscriber falls behind and the ring
+ * fills up, new events are dropped and counted. A subscriber that
+ * sees a non-zero dropped() count knows that it has missed changes,
+ * and must resynchronize, e.g. by rescanning the AtomSpace.
+ *
+ * This is the bounded multi-producer, multi-consumer ring of Dmitry
+ * Vyukov: each cell carries a sequence number, which tells producers
+ * and consumers whose turn it is, so that neither needs a lock.
+ */
+class ChangeSubscriber
+{
+	struct Cell
+	{
+		std::atomic<size_t> seq;
+		AtomEvent event;
+	};
+
+	std::unique_ptr<Cell[]> _ring;
+	size_t _mask;
+
+	// Keep the producer and consumer positions on different cache
+	// lines, so that they do not bounce between cores.
+	alignas(64) std::atomic<size_t> _tail;
+	alignas(64) std::atomic<size_t> _head;
+	alignas(64) std::atomic<size_t> _dropped;
+
+public:
+	/// The capacity is rounded up to a power of two.
+	ChangeSubscriber(size_t capacity) : _tail(0), _head(0), _dropped(0)
+	{
+		size_t cap = 2;
+		while (cap < capacity) cap <<= 1;
+		_ring.reset(new Cell[cap]);
+		_mask = cap - 1;
+		for (size_t i = 0; i < cap; i++)
+			_ring[i].seq.store(i, std::memory_order_relaxed);
+	}
+
+	ChangeSubscriber(const ChangeSubscriber&) = delete;
+	ChangeSubscriber& operator=(const ChangeSubscriber&) = delete;
+
+	/// Append an event. Returns false if the ring is full, in which
+	/// case the event is dropped.
+	bool push(AtomEvent::Kind kind, const Handle& atom,
+	          const Handle& key, const ValuePtr& value)
+	{
+		size_t pos = _tail.load(std::memory_order_relaxed);
+		Cell* cell;
+		while (true)
+		{
+			cell = &_ring[pos & _mask];
+			size_t seq = cell->seq.load(std::memory_order_acquire);
+			intptr_t dif = (intptr_t) seq - (intptr_t) pos;
+			if (0 == dif)
+			{
+				if (_tail.compare_exchange_weak(pos, pos + 1,
+				                                std::memory_order_relaxed))
+					break;
+			}
+			else if (dif < 0)
+			{
+				_dropped.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+			else
+				pos = _tail.load(std::memory_order_relaxed);
+		}
+
+		cell->event.kind = kind;
+		cell->event.atom = atom;
+		cell->event.key = key;
+		cell->event.value = value;
+		cell->seq.store(pos + 1, std::memory_order_release);
+		return true;
+	}
+
+	/// Move up to `max` pending events onto the end of `batch`.
+	/// Returns the number of events moved.
+	size_t drain(std::vector<AtomEvent>& batch, size_t max = SIZE_MAX)
+	{
+		size_t n = 0;
+		size_t pos = _head.load(std::memory_order_relaxed);
+		while (n < max)
+		{
+			Cell* cell = &_ring[pos & _mask];
+			size_t seq = cell->seq.load(std::memory_order_acquire);
+			intptr_t dif = (intptr_t) seq - (intptr_t) (pos + 1);
+			if (0 == dif)
+			{
+				if (not _head.compare_exchange_weak(pos, pos + 1,
+				                                    std::memory_order_relaxed))
+					continue;
+
+				// Moving out of the cell releases the Atom and Value
+				// references, so the ring does not keep them alive.
+				batch.emplace_back(std::move(cell->event));
+				cell->seq.store(pos + _mask + 1, std::memory_order_release);
+				pos++;
+				n++;
+			}
+			else if (dif < 0)
+				break;
+			else
+				pos = _head.load(std::memory_order_relaxed);
+		}
+		return n;
+	}
+
+	/// Number of events dropped because the ring was full.
+	size_t dropped() const
+	{
+		return _dropped.load(std::memory_order_relaxed);
+	}
+
+	size_t capacity() const { return _mask + 1; }
+};
+
+typedef std::shared_ptr<ChangeSubscriber> ChangeSubscriberPtr;
+
+/**
+ * The list of subscribers to changes in one AtomSpace.
+ *
+ * When there are no subscribers, publishing costs a single relaxed
+ * atomic load. Subscribing and unsubscribing are rare, and so they
+ * copy the subscriber list; publishers always see a consistent list
+ * without having to take a lock. Everything is inline, so that Atoms
+ * can publish value changes without a link-time dependency on the
+ * AtomSpace library.
+ */
+class ChangeFeed
+{
+	std::atomic<size_t> _nsubs;
+	std::mutex _mtx;
+
+	typedef std::vector<ChangeSubscriberPtr> SubscriberSeq;
+	std::shared_ptr<const SubscriberSeq> _subs;
+
+public:
+	ChangeFeed() : _nsubs(0), _subs(std::make_shared<SubscriberSeq>()) {}
+
+	bool active() const
+	{
+		return 0 < _nsubs.load(std::memory_order_relaxed);
+	}
+
+	ChangeSubscriberPtr subscribe(size_t capacity)
+	{
+		std::lock_guard<std::mutex> lck(_mtx);
+		ChangeSubscriberPtr sub(std::make_shared<ChangeSubscriber>(capacity));
+		auto subs(std::make_shared<SubscriberSeq>(*std::atomic_load(&_subs)));
+		subs->push_back(sub);
+		std::atomic_store(&_subs, std::shared_ptr<const SubscriberSeq>(subs));
+		_nsubs.store(subs->size(), std::memory_order_release);
+		return sub;
+	}
+
+	void unsubscribe(const ChangeSubscriberPtr& sub)
+	{
+		std::lock_guard<std::mutex> lck(_mtx);
+		auto subs(std::make_shared<SubscriberSeq>());
+		for (const ChangeSubscriberPtr& s : *std::atomic_load(&_subs))
+			if (s != sub) subs->push_back(s);
+		std::atomic_store(&_subs, std::shared_ptr<const SubscriberSeq>(subs));
+		_nsubs.store(subs->size(), std::memory_order_release);
+	}
+
+	void publish(AtomEvent::Kind kind, const Handle& atom,
+	             const Handle& key = Handle::UNDEFINED,
+	             const ValuePtr& value = nullptr)
+	{
+		std::shared_ptr<const SubscriberSeq> subs(std::atomic_load(&_subs));
+		for (const ChangeSubscriberPtr& s : *subs)
+			s->push(kind, atom, key, value);
+	}
+};
+
+/** @}*/
+} // namespace opencog
+
+#endif // _OPENCOG_CHANGE_FEED_H
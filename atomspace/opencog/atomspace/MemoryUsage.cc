@@ -0,0 +1,244 @@
+/*
+ * opencog/atomspace/MemoryUsage.cc
+ *
+ * Copyright (C) 2026 OpenCog Foundation
+ * All Rights Reserved
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License v3 as
+ * published by the Free Software Foundation and including the exceptions
+ * at http://opencog.org/wiki/Licenses
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program; if not, write to:
+ * Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+#include <opencog/atoms/atom_types/NameServer.h>
+#include <opencog/atomspace/AtomSpace.h>
+
+#include "MemoryUsage.h"
+
+using namespace opencog;
+
+// The sizes of the pieces that the containers are made of. These
+// follow the GNU libstdc++ implementations.
+
+// std::make_shared puts a control block of two counts and a vtable
+// pointer in front of the object.
+static const size_t SHARED_BLOCK = 16;
+
+// A red-black tree node: a color, and three pointers.
+static const size_t RB_NODE = 32;
+
+// An unordered_set node: a next pointer, the element and its hash.
+static const size_t HASH_NODE = sizeof(void*) + sizeof(Handle) + sizeof(size_t);
+
+#if HAVE_FOLLY
+// F14 sets store the elements in place, with about a byte of tag per
+// slot, at a load factor of up to 7/8.
+static const size_t INCOMING_ENTRY = (sizeof(WinkPtr) + 1) * 8 / 7;
+#else
+static const size_t INCOMING_ENTRY = RB_NODE + sizeof(WinkPtr);
+#endif
+
+static const size_t VALUE_ENTRY =
+	RB_NODE + sizeof(std::pair<const Handle, ValuePtr>);
+static const size_t INCOMING_BUCKET =
+	RB_NODE + sizeof(std::pair<const Type, WincomingSet>);
+
+// ---------------------------------------------------------------
+
+MemoryUsage AtomSpace::get_memory_usage(size_t top_n, size_t sample) const
+{
+	MemoryUsage mu;
+	if (0 == sample) sample = 1;
+	mu.sample = sample;
+
+	// Min-heap of the largest incoming sets seen so far.
+	typedef std::pair<Handle, size_t> Hub;
+	auto bigger = [](const Hub& a, const Hub& b)
+		{ return a.second > b.second; };
+	std::vector<Hub>& hubs(mu.largest_incoming);
+
+	// The scaled key counts and bytes, summed unrounded, so that the
+	// rounding error does not build up, one sampled Atom at a time.
+	std::map<Handle, std::pair<double, double>> keys;
+
+	TypeIndex::Snapshot snap(typeIndex.snapshot());
+	Type ntypes = nameserver().getNumberOfClasses();
+	for (Type t = 0; t < ntypes; t++)
+	{
+		size_t natoms = snap.size(t);
+		if (0 == natoms) continue;
+
+		std::vector<const AtomSet*> chunks;
+		size_t buckets = 0;
+		snap.foreach_chunk(t, [&](const AtomSet& s) {
+			chunks.push_back(&s);
+			buckets += s.bucket_count();
+		});
+
+		MemoryUsage::TypeUsage& tu(mu.types[t]);
+		tu.count = natoms;
+		tu.index_bytes = natoms * HASH_NODE + buckets * sizeof(void*);
+
+		// Scale by the number of atoms that will be looked at. For
+		// types with few atoms, this is less than the sample rate.
+		size_t nlook = (natoms + sample - 1) / sample;
+		double scale = ((double) natoms) / nlook;
+		size_t atom_bytes = 0;
+		size_t value_bytes = 0;
+		size_t incoming_bytes = 0;
+
+		size_t n = 0;
+		for (const AtomSet* atoms : chunks)
+		for (const Handle& h : *atoms)
+		{
+			if (0 != (n++ % sample)) continue;
+
+			atom_bytes += SHARED_BLOCK + h->footprint();
+
+			std::shared_lock<std::shared_mutex> lck(h->_mtx);
+			for (const auto& kv : h->_values)
+			{
+				// Split shared Values among their holders.
+				const ValuePtr& v(kv.second);
+				size_t vb = VALUE_ENTRY;
+				if (not v->is_atom())
+					vb += (SHARED_BLOCK + v->footprint()) / v.use_count();
+
+				value_bytes += vb;
+				std::pair<double, double>& ku(keys[kv.first]);
+				ku.first += scale;
+				ku.second += vb * scale;
+			}
+
+			if (not h->_use_iset) continue;
+
+			size_t isz = 0;
+			for (const auto& bucket : h->_incoming_set._iset)
+			{
+				incoming_bytes += INCOMING_BUCKET;
+				isz += bucket.second.size();
+			}
+			incoming_bytes += isz * INCOMING_ENTRY;
+			lck.unlock();
+
+			if (0 == isz or 0 == top_n) continue;
+			if (hubs.size() < top_n)
+			{
+				hubs.emplace_back(h, isz);
+				std::push_heap(hubs.begin(), hubs.end(), bigger);
+			}
+			else if (hubs.front().second < isz)
+			{
+				std::pop_heap(hubs.begin(), hubs.end(), bigger);
+				hubs.back() = {h, isz};
+				std::push_heap(hubs.begin(), hubs.end(), bigger);
+			}
+		}
+
+		tu.atom_bytes = std::lround(atom_bytes * scale);
+		tu.value_bytes = std::lround(value_bytes * scale);
+		tu.incoming_bytes = std::lround(incoming_bytes * scale);
+	}
+
+	for (const auto& pr : keys)
+	{
+		MemoryUsage::KeyUsage& ku(mu.keys[pr.first]);
+		ku.count = std::lround(pr.second.first);
+		ku.bytes = std::lround(pr.second.second);
+	}
+
+	std::sort_heap(hubs.begin(), hubs.end(), bigger);
+	return mu;
+}
+
+// ---------------------------------------------------------------
+
+MemoryUsage::TypeUsage MemoryUsage::total() const
+{
+	TypeUsage sum;
+	for (const auto& pr : types)
+	{
+		sum.count += pr.second.count;
+		sum.atom_bytes += pr.second.atom_bytes;
+		sum.value_bytes += pr.second.value_bytes;
+		sum.incoming_bytes += pr.second.incoming_bytes;
+		sum.index_bytes += pr.second.index_bytes;
+	}
+	return sum;
+}
+
+std::string MemoryUsage::to_string(void) const
+{
+	std::stringstream ss;
+	auto row = [&](const std::string& name, const TypeUsage& tu)
+	{
+		ss << std::left << std::setw(28) << name << std::right
+		   << std::setw(11) << tu.count
+		   << std::setw(13) << tu.atom_bytes
+		   << std::setw(13) << tu.value_bytes
+		   << std::setw(13) << tu.incoming_bytes
+		   << std::setw(13) << tu.index_bytes
+		   << std::setw(14) << tu.total() << "\n";
+	};
+
+	if (1 < sample)
+		ss << "Sampled one Atom out of every " << sample << "\n";
+
+	ss << std::left << std::setw(28) << "Type" << std::right
+	   << std::setw(11) << "Atoms"
+	   << std::setw(13) << "Atom bytes"
+	   << std::setw(13) << "Values"
+	   << std::setw(13) << "Incoming"
+	   << std::setw(13) << "Index"
+	   << std::setw(14) << "Total" << "\n";
+
+	std::vector<std::pair<Type, TypeUsage>> bytype(types.begin(), types.end());
+	std::sort(bytype.begin(), bytype.end(),
+		[](const auto& a, const auto& b)
+			{ return a.second.total() > b.second.total(); });
+	for (const auto& pr : bytype)
+		row(nameserver().getTypeName(pr.first), pr.second);
+	row("Total", total());
+
+	if (not keys.empty())
+	{
+		ss << "\n" << std::left << std::setw(52) << "Key" << std::right
+		   << std::setw(11) << "Atoms" << std::setw(14) << "Bytes" << "\n";
+
+		std::vector<std::pair<Handle, KeyUsage>> bykey(keys.begin(), keys.end());
+		std::sort(bykey.begin(), bykey.end(),
+			[](const auto& a, const auto& b)
+				{ return a.second.bytes > b.second.bytes; });
+		for (const auto& pr : bykey)
+			ss << std::left << std::setw(52) << pr.first->to_short_string()
+			   << std::right << std::setw(11) << pr.second.count
+			   << std::setw(14) << pr.second.bytes << "\n";
+	}
+
+	if (not largest_incoming.empty())
+	{
+		ss << "\nLargest incoming sets:\n";
+		for (const auto& pr : largest_incoming)
+			ss << std::setw(11) << pr.second << "  "
+			   << pr.first->to_short_string() << "\n";
+	}
+
+	return ss.str();
+}
+
+/* ===================== END OF FILE ===================== */
@@ -0,0 +1,100 @@
+/*
+ * opencog/atomspace/MemoryUsage.h
+ *
+ * Copyright (C) 2026 OpenCog Foundation
+ * All Rights Reserved
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License v3 as
+ * published by the Free Software Foundation and including the exceptions
+ * at http://opencog.org/wiki/Licenses
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program; if not, write to:
+ * Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#ifndef _OPENCOG_MEMORY_USAGE_H
+#define _OPENCOG_MEMORY_USAGE_H
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <opencog/atoms/base/Handle.h>
+#include <opencog/atoms/atom_types/types.h>
+
+namespace opencog
+{
+/** \addtogroup grp_atomspace
+ *  @{
+ */
+
+/**
+ * An estimate of the RAM used by the Atoms in an AtomSpace, broken
+ * down by Atom type, and by the keys that Values are stored under.
+ * Returned by AtomSpace::get_memory_usage().
+ *
+ * The byte counts are what was asked of the allocator, as worked out
+ * from the sizes of the C++ objects and of the containers in them;
+ * the allocator's own overhead is not included. C++ Atom and Value
+ * subclasses that add members of their own are counted at the size
+ * of their base class. A Value that is shared by several Atoms is
+ * split evenly among them.
+ *
+ * If the report was sampled, only one Atom out of every `sample` was
+ * looked at, and the byte counts and key counts were scaled up to
+ * match. The number of Atoms of each type is always exact; the
+ * largest incoming sets are those of the Atoms that were looked at.
+ */
+struct MemoryUsage
+{
+	/// For each Atom type.
+	struct TypeUsage
+	{
+		size_t count = 0;           // Number of Atoms of this type.
+		size_t atom_bytes = 0;      // The Atoms, with names or outgoing sets.
+		size_t value_bytes = 0;     // All Values, and the maps holding them.
+		size_t incoming_bytes = 0;  // The incoming sets.
+		size_t index_bytes = 0;     // The AtomSpace index entries.
+
+		size_t total() const
+		{
+			return atom_bytes + value_bytes + incoming_bytes + index_bytes;
+		}
+	};
+
+	/// For each key.
+	struct KeyUsage
+	{
+		size_t count = 0;           // Number of Atoms with a Value at key.
+		size_t bytes = 0;
+	};
+
+	size_t sample = 1;
+	std::map<Type, TypeUsage> types;
+	std::map<Handle, KeyUsage> keys;
+
+	/// The Atoms with the largest incoming sets, largest first, with
+	/// the size of each.
+	std::vector<std::pair<Handle, size_t>> largest_incoming;
+
+	/// The sum over all types.
+	TypeUsage total() const;
+
+	/// A printable report, with the types and keys using the most
+	/// memory first, as shown by the CogServer `memory` command.
+	std::string to_string(void) const;
+};
+
+/** @}*/
+} // namespace opencog
+
+#endif // _OPENCOG_MEMORY_USAGE_H
@@ -34,21 +34,27 @@ void TypeIndex::resize(void)
 {
 	_num_types = nameserver().getNumberOfClasses();
 	TYPE_INDEX_UNIQUE_LOCK;
+	size_t old = _idx.size();
 	_idx.resize(_num_types + 1);
+	for (size_t i = old; i < _idx.size(); i++)
+		_idx[i] = make_chunks();
 }
 
 void TypeIndex::clear(void)
 {
-	std::vector<AtomSet> dead;
+	std::vector<ChunksPtr> dead;
 	{
 		TYPE_INDEX_UNIQUE_LOCK;
 		dead.resize(_num_types + 1);
+		for (auto& c : dead)
+			c = make_chunks();
 		dead.swap(_idx);
 
 		// Clear the AtomSpace before releasing the lock.
-		for (auto& s : dead)
-			for (auto& h : s)
-				h->_atom_space = nullptr;
+		for (auto& c : dead)
+			for (auto& s : *c)
+				for (auto& h : *s)
+					h->_atom_space = nullptr;
 	}
 
 	// Do the final cleanup after releasing the lock. This enables
@@ -58,16 +64,80 @@ void TypeIndex::clear(void)
 	// in the `AtomSpace::add()` method. We do it here cause its
 	// easier. Anyway, we can't do the `remove()` under the lock,
 	// that would result in lock inversion.
-	for (auto& s : dead)
+	//
+	// The sets themselves are not cleared; they might be shared
+	// with some Snapshot. Just drop our reference to them.
+	for (auto& c : dead)
 	{
-		for (auto& h : s)
-			h->remove();
-		s.clear();
+		for (auto& s : *c)
+			for (auto& h : *s)
+				h->remove();
+		c.reset();
 	}
 }
 
 // ================================================================
 
+void TypeIndex::split(Type t, size_t nchunks)
+{
+	ChunksPtr& cp(_idx[t]);
+	size_t have = cp->size();
+	if (nchunks <= have) return;
+
+	size_t n = have;
+	while (n < nchunks) n *= 2;
+
+	// Build new chunks, rather than splitting the old ones in place;
+	// the old ones might be held by some Snapshot.
+	ChunksPtr fresh(std::make_shared<Chunks>(n));
+	size_t per = (count(*cp) + n - 1) / n;
+	for (AtomSetPtr& s : *fresh)
+	{
+		s = std::make_shared<AtomSet>();
+		s->reserve(per);
+	}
+	for (const AtomSetPtr& s : *cp)
+		for (const Handle& h : *s)
+			(*fresh)[chunk(h, n)]->insert(h);
+	cp = fresh;
+}
+
+// ================================================================
+
+void TypeIndex::insertAtoms(HandleSeq& hseq)
+{
+	// Count how many of each type there are, so that each type is
+	// split and each chunk grown once, instead of along the way.
+	std::vector<size_t> counts(_idx.size(), 0);
+	for (const Handle& h : hseq)
+		counts.at(h->get_type()) ++;
+
+	TYPE_INDEX_UNIQUE_LOCK;
+	for (size_t t = 0; t < counts.size(); t++)
+	{
+		if (0 == counts[t]) continue;
+		size_t total = count(*_idx[t]) + counts[t];
+		split(t, (total + CHUNK_SIZE - 1) / CHUNK_SIZE);
+
+		ChunksPtr& cp(_idx[t]);
+		if (shared(cp))
+			cp = std::make_shared<Chunks>(*cp);
+		size_t per = (counts[t] + cp->size() - 1) / cp->size();
+		for (AtomSetPtr& sp : *cp)
+		{
+			if (shared(sp))
+				sp = std::make_shared<AtomSet>(*sp);
+			sp->reserve(sp->size() + per);
+		}
+	}
+
+	for (Handle& h : hseq)
+	{
+		auto pr = writable(h).insert(h);
+		if (not pr.second) h = *pr.first;
+	}
+}
+
 void TypeIndex::get_handles_by_type(HandleSeq& hseq,
                                     Type type,
                                     bool subclass) const
@@ -84,9 +154,9 @@ void TypeIndex::get_handles_by_type(HandleSeq& hseq,
 	hseq.reserve(initial_size + size_of_append);
 
 	TYPE_INDEX_SHARED_LOCK;
-	const AtomSet& s(_idx.at(type));
-	for (const Handle& h : s)
-		hseq.push_back(h);
+	for (const AtomSetPtr& s : *_idx.at(type))
+		for (const Handle& h : *s)
+			hseq.push_back(h);
 
 	// Not subclassing? We are done!
 	if (not subclass) return;
@@ -95,9 +165,9 @@ void TypeIndex::get_handles_by_type(HandleSeq& hseq,
 	{
 		if (not _nameserver.isA(t, type)) continue;
 
-		const AtomSet& s(_idx.at(t));
-		for (const Handle& h : s)
-			hseq.push_back(h);
+		for (const AtomSetPtr& s : *_idx.at(t))
+			for (const Handle& h : *s)
+				hseq.push_back(h);
 	}
 }
 
@@ -107,8 +177,8 @@ void TypeIndex::get_handles_by_type(UnorderedHandleSet& hset,
                                     bool subclass) const
 {
 	TYPE_INDEX_SHARED_LOCK;
-	const AtomSet& s(_idx.at(type));
-	hset.insert(s.begin(), s.end());
+	for (const AtomSetPtr& s : *_idx.at(type))
+		hset.insert(s->begin(), s->end());
 
 	// Not subclassing? We are done!
 	if (not subclass) return;
@@ -117,8 +187,8 @@ void TypeIndex::get_handles_by_type(UnorderedHandleSet& hset,
 	{
 		if (not _nameserver.isA(t, type)) continue;
 
-		const AtomSet& s(_idx.at(t));
-	   hset.insert(s.begin(), s.end());
+		for (const AtomSetPtr& s : *_idx.at(t))
+			hset.insert(s->begin(), s->end());
 	}
 }
 
@@ -141,11 +211,11 @@ void TypeIndex::get_rootset_by_type(HandleSeq& hseq,
 	hseq.reserve(initial_size + size_of_append);
 
 	TYPE_INDEX_SHARED_LOCK;
-	const AtomSet& s(_idx.at(type));
-	for (const Handle& h : s)
+	for (const AtomSetPtr& s : *_idx.at(type))
 	{
-		if (h->isIncomingSetEmpty(cas))
-			hseq.push_back(h);
+		for (const Handle& h : *s)
+			if (h->isIncomingSetEmpty(cas))
+				hseq.push_back(h);
 	}
 
 	// Not subclassing? We are done!
@@ -155,10 +225,10 @@ void TypeIndex::get_rootset_by_type(HandleSeq& hseq,
 	{
 		if (not _nameserver.isA(t, type)) continue;
 
-		const AtomSet& s(_idx.at(t));
-		for (const Handle& h : s)
-			if (h->isIncomingSetEmpty(cas))
-				hseq.push_back(h);
+		for (const AtomSetPtr& s : *_idx.at(t))
+			for (const Handle& h : *s)
+				if (h->isIncomingSetEmpty(cas))
+					hseq.push_back(h);
 	}
 }
 
@@ -22,6 +22,8 @@
 #ifndef _OPENCOG_TYPEINDEX_H
 #define _OPENCOG_TYPEINDEX_H
 
+#include <atomic>
+#include <memory>
 #include <mutex>
 #include <vector>
 
@@ -34,6 +36,7 @@
 #include <opencog/atoms/base/Atom.h>
 #include <opencog/atoms/base/Handle.h>
 #include <opencog/atoms/atom_types/types.h>
+#include <opencog/atoms/atom_types/NameServer.h>
 
 namespace opencog
 {
@@ -73,16 +76,157 @@ typedef std::unordered_set<Handle> AtomSet;
  * @todo The iterator is NOT thread-safe against the insertion or
  * removal of atoms!  Either inserting or removing an atom will cause
  * the iterator references to be freed, leading to mystery crashes!
+ * Readers that need to iterate while other threads are writing
+ * should use a Snapshot, below.
+ *
+ * The Atoms of each type are split, by hash, into chunks of at most
+ * CHUNK_SIZE Atoms. Both the chunks and the list of chunks are held
+ * by shared pointer, and are copy-on-write: if a Snapshot is holding
+ * them, the next writer makes a private copy before changing them.
+ * Thus, taking a snapshot costs one pointer copy per type, and, while
+ * a snapshot is alive, the first write to a chunk copies that chunk,
+ * and not the whole type. The copy is made under the unique lock, so
+ * snapshots should still not be kept for longer than needed.
  */
 class TypeIndex
 {
+	public:
+		typedef std::shared_ptr<AtomSet> AtomSetPtr;
+		typedef std::vector<AtomSetPtr> Chunks;
+		typedef std::shared_ptr<Chunks> ChunksPtr;
+		typedef std::shared_ptr<const Chunks> ConstChunksPtr;
+
+		// A type is split into more chunks when one of them grows
+		// larger than this.
+		static constexpr size_t CHUNK_SIZE = 4096;
+
+		/**
+		 * A frozen, read-only view of the index. It is unaffected by
+		 * later insertions or removals, and may be iterated without
+		 * holding any locks. Atoms that are removed after the snapshot
+		 * was taken will still appear in it, although they will no
+		 * longer belong to any AtomSpace.
+		 */
+		class Snapshot
+		{
+			friend class TypeIndex;
+			std::vector<ConstChunksPtr> _sets;
+
+		public:
+			// How many atoms are there of type t?
+			size_t size(Type t) const
+			{
+				if (_sets.size() <= t) return 0;
+				return TypeIndex::count(*_sets[t]);
+			}
+
+			// How many atoms, grand total?
+			size_t size(void) const
+			{
+				size_t cnt = 0;
+				for (const auto& s : _sets)
+					cnt += TypeIndex::count(*s);
+				return cnt;
+			}
+
+			// Is the atom in the snapshot?
+			bool contains(const Handle& h) const
+			{
+				Type t = h->get_type();
+				if (_sets.size() <= t) return false;
+				const Chunks& c(*_sets[t]);
+				return 0 < c[TypeIndex::chunk(h, c.size())]->count(h);
+			}
+
+			// Call `func` on each of the chunks holding the atoms of
+			// exactly type t.
+			template <typename Function>
+			void foreach_chunk(Type t, Function func) const
+			{
+				if (_sets.size() <= t) return;
+				for (const AtomSetPtr& s : *_sets[t])
+					func((const AtomSet&) *s);
+			}
+
+			// Call `func` on every atom of type `type`, and, if
+			// `subclass` is set, of all of its subtypes.
+			template <typename Function>
+			void foreach_atom(Type type, bool subclass, Function func) const
+			{
+				NameServer& ns(nameserver());
+				for (Type t = 0; t < _sets.size(); t++)
+				{
+					if (t != type and not (subclass and ns.isA(t, type)))
+						continue;
+					for (const AtomSetPtr& s : *_sets[t])
+						for (const Handle& h : *s)
+							func(h);
+				}
+			}
+		};
+
 	private:
-		std::vector<AtomSet> _idx;
+		std::vector<ChunksPtr> _idx;
 		size_t _num_types;
 		NameServer& _nameserver;
 
 		// Single, global mutex for locking the index.
 		mutable std::shared_mutex _mtx;
+
+		// Which of `nchunks` chunks does h belong to? The top bits of
+		// the (scrambled) hash are used, so that, when the number of
+		// chunks doubles, chunk i splits into chunks 2i and 2i+1.
+		static size_t chunk(const Handle& h, size_t nchunks)
+		{
+			if (1 == nchunks) return 0;
+			uint64_t hsh = 0x9e3779b97f4a7c15ULL * hash_value(h);
+			return hsh >> (64 - __builtin_ctzll(nchunks));
+		}
+
+		static size_t count(const Chunks& c)
+		{
+			size_t cnt = 0;
+			for (const AtomSetPtr& s : c)
+				cnt += s->size();
+			return cnt;
+		}
+
+		// Is some Snapshot holding this? Snapshots are only taken
+		// under the shared lock, so, with the unique lock held, the
+		// count can only go down. The fence orders the release by the
+		// last Snapshot before our writes.
+		template <typename T>
+		static bool shared(const std::shared_ptr<T>& p)
+		{
+			if (1 < p.use_count()) return true;
+			std::atomic_thread_fence(std::memory_order_acquire);
+			return false;
+		}
+
+		// Return the chunk that h belongs in, making private copies
+		// of it, and of the list of chunks, first, if a Snapshot is
+		// holding them. Must be called with the unique lock held.
+		AtomSet& writable(const Handle& h)
+		{
+			ChunksPtr& cp(_idx.at(h->get_type()));
+			if (shared(cp))
+				cp = std::make_shared<Chunks>(*cp);
+			AtomSetPtr& sp((*cp)[chunk(h, cp->size())]);
+			if (shared(sp))
+				sp = std::make_shared<AtomSet>(*sp);
+			return *sp;
+		}
+
+		// Split the atoms of type t into at least `nchunks` chunks.
+		// Must be called with the unique lock held.
+		void split(Type, size_t nchunks);
+
+		// Fresh, empty list of chunks.
+		static ChunksPtr make_chunks(void)
+		{
+			return std::make_shared<Chunks>(1, std::make_shared<AtomSet>());
+		}
+
 	public:
 		TypeIndex(void);
 		void resize(void);
@@ -91,25 +235,36 @@ class TypeIndex
 		// Else, return nullptr
 		Handle insertAtom(const Handle& h)
 		{
-			AtomSet& s(_idx.at(h->get_type()));
 			TYPE_INDEX_UNIQUE_LOCK;
+			AtomSet& s(writable(h));
 			auto iter = s.find(h);
 			if (s.end() != iter) return *iter;
 			s.insert(h);
+			if (CHUNK_SIZE < s.size())
+			{
+				Type t = h->get_type();
+				split(t, 2 * _idx[t]->size());
+			}
 			return Handle::UNDEFINED;
 		}
 
+		// Bulk version of insertAtom(). The lock is taken only once,
+		// and the chunks are split and grown only once. On return, any
+		// Atom that was already in the index is replaced by the copy
+		// that was found there.
+		void insertAtoms(HandleSeq&);
+
 		bool removeAtom(const Handle& h)
 		{
-			AtomSet& s(_idx.at(h->get_type()));
 			TYPE_INDEX_UNIQUE_LOCK;
-			return 1 == s.erase(h);
+			return 1 == writable(h).erase(h);
 		}
 
 		Handle findAtom(const Handle& h) const
 		{
-			const AtomSet& s(_idx.at(h->get_type()));
 			TYPE_INDEX_SHARED_LOCK;
+			const Chunks& c(*_idx.at(h->get_type()));
+			const AtomSet& s(*c[chunk(h, c.size())]);
 			auto iter = s.find(h);
 			if (s.end() == iter) return Handle::UNDEFINED;
 			return *iter;
@@ -118,9 +273,8 @@ class TypeIndex
 		// How many atoms are there of type t?
 		size_t size(Type t) const
 		{
-			const AtomSet& s(_idx.at(t));
 			TYPE_INDEX_SHARED_LOCK;
-			return s.size();
+			return count(*_idx.at(t));
 		}
 
 		// How many atoms, grand total?
@@ -129,7 +283,7 @@ class TypeIndex
 			size_t cnt = 0;
 			TYPE_INDEX_SHARED_LOCK;
 			for (const auto& s : _idx)
-				cnt += s.size();
+				cnt += count(*s);
 			return cnt;
 		}
 
@@ -149,6 +303,15 @@ class TypeIndex
 
 		void clear(void);
 
+		// Take a snapshot of the entire index.
+		Snapshot snapshot(void) const
+		{
+			Snapshot snap;
+			TYPE_INDEX_SHARED_LOCK;
+			snap._sets.assign(_idx.begin(), _idx.end());
+			return snap;
+		}
+
 		void get_handles_by_type(HandleSeq&, Type, bool subclass) const;
 		void get_handles_by_type(UnorderedHandleSet&, Type, bool subclass) const;
 		void get_rootset_by_type(HandleSeq&, Type, bool subclass,
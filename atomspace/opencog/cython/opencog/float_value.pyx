@@ -1,26 +1,75 @@
+from cpython.buffer cimport PyObject_CheckBuffer, PyBUF_WRITABLE
+from libcpp.utility cimport move
 
 def createFloatValue(arg):
     cdef shared_ptr[cFloatValue] c_ptr
+    cdef vector[double] cpp_vector
     if (isinstance(arg, list)):
-        c_ptr.reset(new cFloatValue(FloatValue.list_of_doubles_to_vector(arg)))
+        cpp_vector = FloatValue.list_of_doubles_to_vector(arg)
+        c_ptr.reset(new cFloatValue(move(cpp_vector)))
+    elif PyObject_CheckBuffer(arg):
+        cpp_vector = FloatValue.buffer_to_vector(arg)
+        c_ptr.reset(new cFloatValue(move(cpp_vector)))
     else:
         c_ptr.reset(new cFloatValue(<double>arg))
     return FloatValue(PtrHolder.create(<shared_ptr[void]&>c_ptr))
 
 cdef class FloatValue(Value):
 
+    # FloatValues are immutable, so the vector of doubles can be
+    # handed out directly, read-only, with no copying. Thus, for
+    # example, numpy.asarray(fv) is a view onto the FloatValue, and
+    # memoryview(fv) works as well. The view holds a reference to
+    # this object, and so the FloatValue outlives the view.
+    def __getbuffer__(self, Py_buffer* buffer, int flags):
+        if flags & PyBUF_WRITABLE:
+            raise BufferError('FloatValue is read-only')
+        cdef const vector[double]* vec = \
+            &((<cFloatValue*>self.get_c_value_ptr().get()).value())
+        self._shape[0] = vec.size()
+        self._strides[0] = sizeof(double)
+        buffer.buf = <void*>vec.data()
+        buffer.obj = self
+        buffer.len = vec.size() * sizeof(double)
+        buffer.readonly = 1
+        buffer.itemsize = sizeof(double)
+        buffer.format = 'd'
+        buffer.ndim = 1
+        buffer.shape = self._shape
+        buffer.strides = self._strides
+        buffer.suboffsets = NULL
+        buffer.internal = NULL
+
+    def __releasebuffer__(self, Py_buffer* buffer):
+        pass
+
     def to_list(self):
-        return FloatValue.vector_of_doubles_to_list(
-            &((<cFloatValue*>self.get_c_value_ptr().get()).value()))
+        return memoryview(self).tolist()
 
     @staticmethod
     cdef vector[double] list_of_doubles_to_vector(list python_list):
         cdef vector[double] cpp_vector
         cdef double value
+        cpp_vector.reserve(len(python_list))
         for value in python_list:
             cpp_vector.push_back(value)
         return cpp_vector
 
+    # Copy a contiguous buffer of doubles, such as a float64 numpy
+    # array, in one go. Anything else (other dtypes, strided views)
+    # is converted element by element.
+    @staticmethod
+    cdef vector[double] buffer_to_vector(object buf):
+        cdef vector[double] cpp_vector
+        cdef const double[::1] view
+        try:
+            view = buf
+        except (ValueError, TypeError):
+            return FloatValue.list_of_doubles_to_vector(list(buf))
+        if view.shape[0] > 0:
+            cpp_vector.assign(&view[0], &view[0] + view.shape[0])
+        return cpp_vector
+
     @staticmethod
     cdef list vector_of_doubles_to_list(const vector[double]* cpp_vector):
         list = []
@@ -29,4 +78,3 @@ cdef class FloatValue(Value):
             list.append(deref(it))
             inc(it)
         return list
-
@@ -1,8 +1,10 @@
 
 def createStringValue(arg):
     cdef shared_ptr[cStringValue] c_ptr
+    cdef vector[string] cpp_vector
     if (isinstance(arg, list)):
-        c_ptr.reset(new cStringValue(StringValue.list_of_strings_to_vector(arg)))
+        cpp_vector = StringValue.list_of_strings_to_vector(arg)
+        c_ptr.reset(new cStringValue(move(cpp_vector)))
     else:
         c_ptr.reset(new cStringValue(<string>(arg.encode('UTF-8'))))
     return StringValue(PtrHolder.create(<shared_ptr[void]&>c_ptr))
@@ -16,6 +18,7 @@ cdef class StringValue(Value):
     @staticmethod
     cdef vector[string] list_of_strings_to_vector(list python_list):
         cdef vector[string] cpp_vector
+        cpp_vector.reserve(len(python_list))
         for value in python_list:
             cpp_vector.push_back(value.encode('UTF-8'))
         return cpp_vector
@@ -1,7 +1,14 @@
 cdef class FloatValue(Value):
+    # Shape and strides handed out by the buffer protocol.
+    cdef Py_ssize_t _shape[1]
+    cdef Py_ssize_t _strides[1]
+
     @staticmethod
     cdef vector[double] list_of_doubles_to_vector(list python_list)
 
+    @staticmethod
+    cdef vector[double] buffer_to_vector(object buf)
+
     @staticmethod
     cdef list vector_of_doubles_to_list(const vector[double]* cpp_vector)
 
@@ -339,6 +339,9 @@ void SchemeSmob::register_procs()
 	// Value API
 	register_proc("cog-value->list",       1, 0, 0, C(ss_value_to_list));
 	register_proc("cog-value-ref",         2, 1, 0, C(ss_value_ref));
+	register_proc("cog-value-column",      2, 1, 0, C(ss_value_column));
+	register_proc("cog-type-value-column", 2, 2, 0, C(ss_type_value_column));
+	register_proc("cog-set-value-column!", 3, 0, 0, C(ss_set_value_column));
 
 	// Generic property setter on atoms
 	register_proc("cog-set-value!",        3, 0, 0, C(ss_set_value));
@@ -397,6 +400,7 @@ void SchemeSmob::register_procs()
 
 	// Taking AtomSpace as optional argument
 	register_proc("cog-count-atoms",       1, 1, 0, C(ss_count));
+	register_proc("cog-memory-usage",      0, 3, 0, C(ss_as_memory));
 	register_proc("cog-map-type",          2, 1, 0, C(ss_map_type));
 
 	// Value types
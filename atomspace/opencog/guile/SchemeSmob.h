@@ -126,6 +126,11 @@ private:
 	static SCM ss_value_ref(SCM, SCM, SCM);
 	static SCM value_ref(const ValuePtr&, size_t);
 
+	// Bulk access to one number on many atoms
+	static SCM ss_value_column(SCM, SCM, SCM);
+	static SCM ss_type_value_column(SCM, SCM, SCM, SCM);
+	static SCM ss_set_value_column(SCM, SCM, SCM);
+
 	// Property setters on atoms
 	static SCM ss_set_tv(SCM, SCM);
 	static SCM ss_set_value(SCM, SCM, SCM);
@@ -183,6 +188,7 @@ private:
 	static SCM ss_as_env(SCM);
 	static SCM ss_as_uuid(SCM);
 	static SCM ss_as_clear(SCM);
+	static SCM ss_as_memory(SCM, SCM, SCM);
 	static SCM ss_as_mark_readonly(SCM);
 	static SCM ss_as_mark_readwrite(SCM);
 	static SCM ss_as_readonly_p(SCM);
@@ -258,6 +258,65 @@ SCM SchemeSmob::ss_as_clear(SCM sas)
 	return SCM_BOOL_T;
 }
 
+/* ============================================================== */
+/**
+ * Return an association list estimating the memory used by the
+ * atomspace, by atom type and by value key; see AtomSpace.h
+ */
+SCM SchemeSmob::ss_as_memory(SCM stop, SCM ssample, SCM sas)
+{
+	static const char* msg = "cog-memory-usage";
+	size_t top_n = 10;
+	if (not scm_is_eq(stop, SCM_UNDEFINED))
+		top_n = verify_size_t(stop, msg, 1);
+	size_t sample = 1;
+	if (not scm_is_eq(ssample, SCM_UNDEFINED))
+		sample = verify_size_t(ssample, msg, 2);
+
+	const AtomSpacePtr& asg = ss_to_atomspace(sas);
+	const AtomSpacePtr& asp = asg ? asg : ss_get_env_as(msg);
+
+	MemoryUsage mu(asp->get_memory_usage(top_n, sample));
+	scm_remember_upto_here_1(sas);
+
+	auto usage = [](const MemoryUsage::TypeUsage& tu)
+	{
+		return scm_list_n(
+			scm_from_size_t(tu.count),
+			scm_from_size_t(tu.atom_bytes),
+			scm_from_size_t(tu.value_bytes),
+			scm_from_size_t(tu.incoming_bytes),
+			scm_from_size_t(tu.index_bytes),
+			SCM_UNDEFINED);
+	};
+
+	SCM stypes = SCM_EOL;
+	for (auto it = mu.types.rbegin(); it != mu.types.rend(); it++)
+	{
+		const std::string& tname = nameserver().getTypeName(it->first);
+		stypes = scm_cons(scm_cons(scm_from_utf8_symbol(tname.c_str()),
+			usage(it->second)), stypes);
+	}
+
+	SCM skeys = SCM_EOL;
+	for (const auto& pr : mu.keys)
+		skeys = scm_cons(scm_list_3(handle_to_scm(pr.first),
+			scm_from_size_t(pr.second.count),
+			scm_from_size_t(pr.second.bytes)), skeys);
+
+	SCM shubs = SCM_EOL;
+	for (auto it = mu.largest_incoming.rbegin();
+	     it != mu.largest_incoming.rend(); it++)
+		shubs = scm_cons(scm_cons(handle_to_scm(it->first),
+			scm_from_size_t(it->second)), shubs);
+
+	return scm_list_4(
+		scm_cons(scm_from_utf8_symbol("total"), usage(mu.total())),
+		scm_cons(scm_from_utf8_symbol("types"), stypes),
+		scm_cons(scm_from_utf8_symbol("keys"), skeys),
+		scm_cons(scm_from_utf8_symbol("largest-incoming"), shubs));
+}
+
 /* ============================================================== */
 /**
  * Return the atomspace of an atom.
@@ -21,6 +21,7 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
  */
 
+#include <cmath>
 #include <cstddef>
 #include <libguile.h>
 
@@ -762,4 +763,134 @@ SCM SchemeSmob::value_ref (const ValuePtr& pa, size_t index)
 	return SCM_EOL;
 }
 
+/* ============================================================== */
+/*
+ * Bulk access to Values. Count-processing scripts typically loop over
+ * every atom of some type, fetching or setting one number on each.
+ * Each trip into and out of guile costs far more than the fetch
+ * itself; these move one number per atom, for all of the atoms, in a
+ * single call, packed into an f64vector.
+ */
+
+/// Return an f64vector holding the `index`'th entry of the value at
+/// `key` on each atom, or NaN if there is no such entry.
+static SCM value_column(const HandleSeq& atoms, const Handle& key,
+                        size_t index)
+{
+	SCM svec = scm_make_f64vector(scm_from_size_t(atoms.size()),
+	                              scm_from_double(NAN));
+
+	scm_t_array_handle ah;
+	size_t len;
+	ssize_t inc;
+	double* elt = scm_f64vector_writable_elements(svec, &ah, &len, &inc);
+	for (size_t i = 0; i < len; i++, elt += inc)
+	{
+		ValuePtr vp(atoms[i]->getValue(key));
+		if (nullptr == vp) continue;
+
+		Type t = vp->get_type();
+		const std::vector<double>* v = nullptr;
+		if (nameserver().isA(t, FLOAT_VALUE))
+			v = &FloatValueCast(vp)->value();
+		else if (nameserver().isA(t, NUMBER_NODE))
+			v = &NumberNodeCast(vp)->value();
+
+		if (v and index < v->size()) *elt = (*v)[index];
+	}
+	scm_array_handle_release(&ah);
+	return svec;
+}
+
+SCM SchemeSmob::ss_value_column (SCM satoms, SCM skey, SCM sindex)
+{
+	HandleSeq atoms(verify_handle_list(satoms, "cog-value-column", 1));
+	Handle key(verify_handle(skey, "cog-value-column", 2));
+	size_t index = 0;
+	if (not scm_is_eq(sindex, SCM_UNDEFINED))
+		index = verify_size_t(sindex, "cog-value-column", 3);
+
+	return value_column(atoms, key, index);
+}
+
+SCM SchemeSmob::ss_type_value_column (SCM stype, SCM skey, SCM sindex,
+                                      SCM aspace)
+{
+	Type t = verify_type(stype, "cog-type-value-column", 1);
+	Handle key(verify_handle(skey, "cog-type-value-column", 2));
+	size_t index = 0;
+	if (not scm_is_eq(sindex, SCM_UNDEFINED))
+		index = verify_size_t(sindex, "cog-type-value-column", 3);
+
+	const AtomSpacePtr& asg = ss_to_atomspace(aspace);
+	const AtomSpacePtr& asp = asg ? asg :
+		ss_get_env_as("cog-type-value-column");
+
+	HandleSeq atoms;
+	asp->get_handles_by_type(atoms, t);
+
+	SCM svec = value_column(atoms, key, index);
+
+	SCM slist = SCM_EOL;
+	for (auto it = atoms.rbegin(); it != atoms.rend(); it++)
+		slist = scm_cons(handle_to_scm(*it), slist);
+
+	return scm_cons(slist, svec);
+}
+
+SCM SchemeSmob::ss_set_value_column (SCM satoms, SCM skey, SCM svec)
+{
+	static const char* msg = "cog-set-value-column!";
+	HandleSeq atoms(verify_handle_list(satoms, msg, 1));
+	Handle key(verify_handle(skey, msg, 2));
+
+	std::vector<double> vals;
+	if (scm_is_true(scm_f64vector_p(svec)))
+	{
+		scm_t_array_handle ah;
+		size_t len;
+		ssize_t inc;
+		const double* elt = scm_f64vector_elements(svec, &ah, &len, &inc);
+		vals.reserve(len);
+		for (size_t i = 0; i < len; i++, elt += inc)
+			vals.push_back(*elt);
+		scm_array_handle_release(&ah);
+	}
+	else
+		vals = verify_float_list(svec, msg, 3);
+
+	if (vals.size() != atoms.size())
+		scm_wrong_type_arg_msg(msg, 3, svec,
+			"a vector of the same length as the list of atoms");
+
+	const AtomSpacePtr& asp = ss_get_env_as(msg);
+
+	// Copy-on-write AtomSpaces may hand back a different Atom; if so,
+	// the list of the new Atoms is returned.
+	HandleSeq newatoms;
+	newatoms.reserve(atoms.size());
+	bool changed = false;
+	try
+	{
+		for (size_t i = 0; i < atoms.size(); i++)
+		{
+			Handle newh(asp->set_value(atoms[i], key,
+			                           createFloatValue(vals[i])));
+			changed = changed or (newh != atoms[i]);
+			newatoms.emplace_back(newh);
+		}
+	}
+	catch (const std::exception& ex)
+	{
+		throw_exception(ex, msg, satoms);
+	}
+
+	if (not changed) return satoms;
+
+	SCM slist = SCM_EOL;
+	for (auto it = newatoms.rbegin(); it != newatoms.rend(); it++)
+		slist = scm_cons(handle_to_scm(*it), slist);
+	return slist;
+}
+
 /* ===================== END OF FILE ============================ */
@@ -0,0 +1,283 @@
+/*
+ * DiscriminationTree.cc
+ *
+ * Copyright (C) 2026 OpenCog Foundation
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License v3 as
+ * published by the Free Software Foundation and including the exceptions
+ * at http://opencog.org/wiki/Licenses
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program; if not, write to:
+ * Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <algorithm>
+
+#include <opencog/atoms/atom_types/NameServer.h>
+#include <opencog/atoms/base/Atom.h>
+
+#include "DiscriminationTree.h"
+
+using namespace opencog;
+
+/* ======================================================== */
+
+DiscriminationTree::DiscriminationTree() : _size(0)
+{
+}
+
+DiscriminationTree::~DiscriminationTree()
+{
+}
+
+void DiscriminationTree::clear(void)
+{
+	_root.nodes.clear();
+	_root.links.clear();
+	_root.open.clear();
+	_root.prefix.clear();
+	_root.rest.reset();
+	_root.star.reset();
+	_root.leaves.clear();
+	_size = 0;
+}
+
+bool DiscriminationTree::Branch::empty(void) const
+{
+	return nodes.empty() and links.empty() and open.empty()
+		and prefix.empty() and nullptr == rest and nullptr == star
+		and leaves.empty();
+}
+
+/* ======================================================== */
+
+/// Flatten a pattern into its keys. If `loose`, links are keyed by
+/// type alone.
+void DiscriminationTree::flatten(const Handle& h, KeySeq& keys, bool loose)
+{
+	Type t = h->get_type();
+	if (VARIABLE_NODE == t or GLOB_NODE == t)
+	{
+		keys.push_back({Key::STAR, t, 0, Handle::UNDEFINED});
+		return;
+	}
+
+	if (h->is_node())
+	{
+		keys.push_back({Key::NODE, t, 0, h});
+		return;
+	}
+
+	// The Recognizer matches these in ways that do not follow the
+	// order of the outgoing set; key the type alone.
+	if (loose or nameserver().isA(t, UNORDERED_LINK))
+	{
+		keys.push_back({Key::OPEN, t, 0, Handle::UNDEFINED});
+		return;
+	}
+
+	// Ahead of the first glob, atoms are where they are, but links
+	// are compared by type only.
+	const HandleSeq& oset = h->getOutgoingSet();
+	size_t nfix = 0;
+	while (nfix < oset.size() and GLOB_NODE != oset[nfix]->get_type())
+		nfix++;
+
+	if (nfix < oset.size())
+	{
+		keys.push_back({Key::PREFIX, t, nfix, Handle::UNDEFINED});
+		for (size_t i = 0; i < nfix; i++)
+			flatten(oset[i], keys, true);
+		keys.push_back({Key::REST, t, 0, Handle::UNDEFINED});
+		return;
+	}
+
+	keys.push_back({Key::LINK, t, oset.size(), Handle::UNDEFINED});
+	for (const Handle& o : oset)
+		flatten(o, keys);
+}
+
+/// Return the slot for the key's branch; null if there is none, unless
+/// `create` is set.
+std::unique_ptr<DiscriminationTree::Branch>*
+DiscriminationTree::slot(Branch* b, const Key& k, bool create)
+{
+	switch (k.kind)
+	{
+		case Key::NODE:
+			if (create) return &b->nodes[k.node];
+			else {
+				auto it = b->nodes.find(k.node);
+				return it == b->nodes.end() ? nullptr : &it->second;
+			}
+		case Key::LINK:
+			if (create) return &b->links[{k.type, k.arity}];
+			else {
+				auto it = b->links.find({k.type, k.arity});
+				return it == b->links.end() ? nullptr : &it->second;
+			}
+		case Key::OPEN:
+			if (create) return &b->open[k.type];
+			else {
+				auto it = b->open.find(k.type);
+				return it == b->open.end() ? nullptr : &it->second;
+			}
+		case Key::PREFIX:
+			if (create) return &b->prefix[{k.type, k.arity}];
+			else {
+				auto it = b->prefix.find({k.type, k.arity});
+				return it == b->prefix.end() ? nullptr : &it->second;
+			}
+		case Key::REST:
+			return (create or b->rest) ? &b->rest : nullptr;
+		default:
+			return (create or b->star) ? &b->star : nullptr;
+	}
+}
+
+void DiscriminationTree::erase(Branch* b, const Key& k)
+{
+	switch (k.kind)
+	{
+		case Key::NODE: b->nodes.erase(k.node); break;
+		case Key::LINK: b->links.erase({k.type, k.arity}); break;
+		case Key::OPEN: b->open.erase(k.type); break;
+		case Key::PREFIX: b->prefix.erase({k.type, k.arity}); break;
+		case Key::REST: b->rest.reset(); break;
+		default: b->star.reset(); break;
+	}
+}
+
+void DiscriminationTree::insert(const Handle& pattern)
+{
+	KeySeq keys;
+	flatten(pattern, keys);
+
+	Branch* b = &_root;
+	for (const Key& k : keys)
+	{
+		std::unique_ptr<Branch>* s = slot(b, k, true);
+		if (nullptr == *s) s->reset(new Branch());
+		b = s->get();
+	}
+
+	if (std::find(b->leaves.begin(), b->leaves.end(), pattern)
+	    != b->leaves.end()) return;
+	b->leaves.push_back(pattern);
+	_size++;
+}
+
+/// Remove the pattern from below `b`, pruning the branches that are
+/// left empty. Return true if it was found.
+bool DiscriminationTree::remove(Branch* b, const KeySeq& keys,
+                                size_t i, const Handle& pattern)
+{
+	if (i == keys.size())
+	{
+		auto it = std::find(b->leaves.begin(), b->leaves.end(), pattern);
+		if (it == b->leaves.end()) return false;
+		*it = b->leaves.back();
+		b->leaves.pop_back();
+		return true;
+	}
+
+	std::unique_ptr<Branch>* s = slot(b, keys[i], false);
+	if (nullptr == s) return false;
+
+	bool found = remove(s->get(), keys, i+1, pattern);
+	if ((*s)->empty()) erase(b, keys[i]);
+	return found;
+}
+
+void DiscriminationTree::remove(const Handle& pattern)
+{
+	KeySeq keys;
+	flatten(pattern, keys);
+	if (remove(&_root, keys, 0, pattern)) _size--;
+}
+
+/* ======================================================== */
+
+size_t DiscriminationTree::flatten(const Handle& h, Term& term)
+{
+	size_t i = term.atoms.size();
+	term.atoms.push_back(h);
+	term.skip.push_back(0);
+	if (h->is_link())
+		for (const Handle& o : h->getOutgoingSet())
+			flatten(o, term);
+	term.skip[i] = term.atoms.size();
+	return i;
+}
+
+/// Walk the branches that match the term from position `i` on. The
+/// `ends` are where to resume, once the keyed prefix of a link with
+/// globs in it has been matched.
+void DiscriminationTree::lookup(const Branch* b, const Term& term,
+                                size_t i, std::vector<size_t>& ends,
+                                HandleSeq& cands)
+{
+	if (b->rest and not ends.empty())
+	{
+		size_t end = ends.back();
+		ends.pop_back();
+		lookup(b->rest.get(), term, end, ends, cands);
+		ends.push_back(end);
+	}
+
+	if (i == term.atoms.size())
+	{
+		cands.insert(cands.end(), b->leaves.begin(), b->leaves.end());
+		return;
+	}
+
+	if (b->star)
+		lookup(b->star.get(), term, term.skip[i], ends, cands);
+
+	const Handle& h = term.atoms[i];
+	if (h->is_node())
+	{
+		auto it = b->nodes.find(h);
+		if (it != b->nodes.end())
+			lookup(it->second.get(), term, i+1, ends, cands);
+		return;
+	}
+
+	Type t = h->get_type();
+	size_t arity = h->get_arity();
+	auto lit = b->links.find({t, arity});
+	if (lit != b->links.end())
+		lookup(lit->second.get(), term, i+1, ends, cands);
+
+	auto oit = b->open.find(t);
+	if (oit != b->open.end())
+		lookup(oit->second.get(), term, term.skip[i], ends, cands);
+
+	// Links with globs, keyed by no more atoms than the term has.
+	auto pit = b->prefix.lower_bound({t, 0});
+	auto pend = b->prefix.upper_bound({t, arity});
+	for (; pit != pend; pit++)
+	{
+		ends.push_back(term.skip[i]);
+		lookup(pit->second.get(), term, i+1, ends, cands);
+		ends.pop_back();
+	}
+}
+
+void DiscriminationTree::lookup(const Handle& term, HandleSeq& cands) const
+{
+	Term flat;
+	flatten(term, flat);
+	std::vector<size_t> ends;
+	lookup(&_root, flat, 0, ends, cands);
+}
+
+/* ===================== END OF FILE ===================== */
@@ -0,0 +1,124 @@
+/*
+ * DiscriminationTree.h
+ *
+ * Copyright (C) 2026 OpenCog Foundation
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License v3 as
+ * published by the Free Software Foundation and including the exceptions
+ * at http://opencog.org/wiki/Licenses
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program; if not, write to:
+ * Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#ifndef _OPENCOG_DISCRIMINATION_TREE_H
+#define _OPENCOG_DISCRIMINATION_TREE_H
+
+#include <map>
+#include <memory>
+#include <unordered_map>
+
+#include <opencog/atoms/base/Handle.h>
+
+namespace opencog {
+
+/**
+ * A discrimination tree: a trie of patterns, for finding all of the
+ * patterns that might match a given term, without looking at the
+ * patterns that can't.
+ *
+ * Each pattern is flattened, in prefix order, into a sequence of
+ * keys: a node is its own key, an ordered link is keyed by its type
+ * and arity, and a VariableNode or GlobNode is a wildcard. The keys
+ * form a path in the trie, at the end of which the pattern is stored.
+ * A lookup walks the trie along the flattened term; at a wildcard,
+ * it skips over a whole subterm. The cost is proportional to the size
+ * of the term, times however many wildcard branches are alive at
+ * once; it does not depend on the number of patterns stored.
+ *
+ * The lookup is a filter, not a match: it may return patterns that
+ * do not match, but never misses one that does, in the sense of the
+ * Recognizer. To keep it so, the contents of unordered links are not
+ * keyed, only the link type is. For links with a GlobNode directly in
+ * them, only the atoms ahead of the first glob are keyed, as only
+ * their positions are known; of these, the links are keyed by type
+ * alone. Variable types and repeated variables are ignored. The
+ * candidates still have to be checked.
+ *
+ * This class does no locking.
+ */
+class DiscriminationTree
+{
+public:
+	DiscriminationTree();
+	~DiscriminationTree();
+
+	/// Store the pattern. Storing it again has no effect.
+	void insert(const Handle& pattern);
+
+	/// Remove the pattern; it is not an error if it is absent.
+	void remove(const Handle& pattern);
+
+	/// Add to `cands` every stored pattern that might match `term`.
+	void lookup(const Handle& term, HandleSeq& cands) const;
+
+	/// Number of stored patterns.
+	size_t size(void) const { return _size; }
+
+	void clear(void);
+
+private:
+	struct Key
+	{
+		enum Kind { NODE, LINK, OPEN, PREFIX, REST, STAR };
+		Kind kind;
+		Type type;
+		size_t arity;
+		Handle node;
+	};
+	typedef std::vector<Key> KeySeq;
+
+	struct Branch
+	{
+		std::unordered_map<Handle, std::unique_ptr<Branch>> nodes;
+		std::map<std::pair<Type, size_t>, std::unique_ptr<Branch>> links;
+		std::map<Type, std::unique_ptr<Branch>> open;
+		std::map<std::pair<Type, size_t>, std::unique_ptr<Branch>> prefix;
+		std::unique_ptr<Branch> rest;
+		std::unique_ptr<Branch> star;
+		HandleSeq leaves;
+
+		bool empty(void) const;
+	};
+
+	Branch _root;
+	size_t _size;
+
+	static void flatten(const Handle&, KeySeq&, bool loose = false);
+	static std::unique_ptr<Branch>* slot(Branch*, const Key&, bool);
+	static void erase(Branch*, const Key&);
+	static bool remove(Branch*, const KeySeq&, size_t, const Handle&);
+
+	// The term, flattened in prefix order; skip[i] is the index just
+	// past the subterm that starts at i.
+	struct Term
+	{
+		HandleSeq atoms;
+		std::vector<size_t> skip;
+	};
+	static size_t flatten(const Handle&, Term&);
+	static void lookup(const Branch*, const Term&, size_t,
+	                   std::vector<size_t>&, HandleSeq&);
+};
+
+} // namespace opencog
+
+#endif // _OPENCOG_DISCRIMINATION_TREE_H
@@ -1141,6 +1141,10 @@ bool InitiateSearchMixin::search_loop(PatternMatchCallback& pmc,
 	_recursing = true;
 #endif
 
+	if (_profile)
+		_profile->add_start(_root->getHandle(), _starter_term->getHandle(),
+		                    _search_set.size());
+
 	if (_recursing)
 	{
 		// Plain-old, olde-fashioned sequential search loop.
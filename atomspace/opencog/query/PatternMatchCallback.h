@@ -30,6 +30,7 @@
 #include <opencog/atoms/base/Link.h>
 #include <opencog/atoms/pattern/PatternLink.h>
 #include <opencog/atoms/pattern/PatternTerm.h> // for pattern context
+#include <opencog/query/QueryProfile.h>
 
 namespace opencog {
 
@@ -405,6 +406,12 @@ class PatternMatchCallback
 			_pattern = &pat;
 		}
 
+		/**
+		 * The profile being collected for the search, or null if the
+		 * query did not ask for one. See QueryProfile.h
+		 */
+		QueryProfile* _profile = nullptr;
+
 		/**
 		 * You get to call this, to perform the actual search.
 		 */
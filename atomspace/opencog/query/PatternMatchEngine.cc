@@ -544,6 +544,7 @@ bool PatternMatchEngine::unorder_compare(const PatternTermPtr& ptm,
 	do
 	{
 		bool match = true;
+		_count.perm_steps++;
 		solution_push();
 
 		// If we've been told to take a step, then take it now.
@@ -740,6 +741,7 @@ PatternMatchEngine::curr_perm(const PatternTermPtr& ptm)
 	// Do not have a currently-running permuation. Create a new one.
 	DO_LOG({LAZY_LOG_FINE << "tree_comp FRESH START unordered term="
 	                      << ptm->to_string();})
+	_count.perm_starts++;
 	Permutation perm = ptm->getOutgoingSet();
 	// Sort into explicit std::less<PatternTermPtr>() order, as
 	// otherwise std::next_permutation() will miss some perms.
@@ -1487,6 +1489,7 @@ bool PatternMatchEngine::tree_compare(const PatternTermPtr& ptm,
                                       const Handle& hg,
                                       Caller caller)
 {
+	_count.tree_compares++;
 	const Handle& hp = ptm->getHandle();
 
 	// Do we already have a grounding for this? If we do, and the
@@ -1599,6 +1602,8 @@ bool PatternMatchEngine::explore_up_branches(const PatternTermPtr& ptm,
                                              const Handle& hg,
                                              const PatternTermPtr& clause)
 {
+	_count.branches[QueryProfile::UP_BRANCHES]++;
+
 	const PatternTermPtr& parent(ptm->getParent());
 
 	if (clause == parent and clause->hasEvaluatable())
@@ -1633,6 +1638,8 @@ bool PatternMatchEngine::explore_upord_branches(const PatternTermPtr& ptm,
                                                 const Handle& hg,
                                                 const PatternTermPtr& clause)
 {
+	_count.branches[QueryProfile::UPORD_BRANCHES]++;
+
 	// Move up the solution graph, looking for a match.
 	const PatternTermPtr& parent(ptm->getParent());
 	Type t = parent->getHandle()->get_type();
@@ -1736,6 +1743,8 @@ bool PatternMatchEngine::explore_upund_branches(const PatternTermPtr& ptm,
                                                 const Handle& hg,
                                                 const PatternTermPtr& clause)
 {
+	_count.branches[QueryProfile::UPUND_BRANCHES]++;
+
 	// Move up the solution graph, looking for a match.
 	const PatternTermPtr& parent(ptm->getParent());
 	Type t = parent->getHandle()->get_type();
@@ -1778,6 +1787,8 @@ bool PatternMatchEngine::explore_upspar_branches(const PatternTermPtr& ptm,
                                                  const Handle& hg,
                                                  const PatternTermPtr& clause)
 {
+	_count.branches[QueryProfile::UPSPAR_BRANCHES]++;
+
 	// Move up the solution graph, looking for a match.
 	const PatternTermPtr& parent(ptm->getParent());
 	Type t = parent->getHandle()->get_type();
@@ -1840,6 +1851,8 @@ bool PatternMatchEngine::explore_upglob_branches(const PatternTermPtr& ptm,
                                                  const Handle& hg,
                                                  const PatternTermPtr& clause)
 {
+	_count.branches[QueryProfile::UPGLOB_BRANCHES]++;
+
 	const PatternTermPtr& parent(ptm->getParent());
 	Type t = parent->getHandle()->get_type();
 	IncomingSet iset;
@@ -1893,6 +1906,8 @@ bool PatternMatchEngine::explore_glob_branches(const PatternTermPtr& ptm,
                                                const Handle& hg,
                                                const PatternTermPtr& clause)
 {
+	_count.branches[QueryProfile::GLOB_BRANCHES]++;
+
 	// Check to make sure the pattern actually has globs in it!
 	OC_ASSERT(ptm->hasAnyGlobbyVar(),
 	          "Glob exploration went horribly wrong!");
@@ -1928,6 +1943,8 @@ bool PatternMatchEngine::explore_odometer(const PatternTermPtr& ptm,
                                           const Handle& hg,
                                           const PatternTermPtr& clause)
 {
+	_count.branches[QueryProfile::ODOMETER]++;
+
 	bool found = explore_type_branches(ptm, hg, clause);
 	if (found)
 		return true;
@@ -1969,6 +1986,8 @@ bool PatternMatchEngine::explore_unordered_branches(const PatternTermPtr& ptm,
                                                     const Handle& hg,
                                                     const PatternTermPtr& clause)
 {
+	_count.branches[QueryProfile::UNORDERED_BRANCHES]++;
+
 	do
 	{
 		// If the pattern was satisfied, then we are done for good.
@@ -2026,6 +2045,8 @@ bool PatternMatchEngine::explore_sparse_branches(const PatternTermPtr& ptm,
                                                  const Handle& hg,
                                                  const PatternTermPtr& clause)
 {
+	_count.branches[QueryProfile::SPARSE_BRANCHES]++;
+
 	logmsg("Explore sparse: Start exploration");
 
 	// XXX TODO FIXME. The ptm needs to be decomposed into connected
@@ -2077,6 +2098,8 @@ bool PatternMatchEngine::explore_type_branches(const PatternTermPtr& ptm,
                                                const Handle& hg,
                                                const PatternTermPtr& clause)
 {
+	_count.branches[QueryProfile::TYPE_BRANCHES]++;
+
 	// Iterate over different possible choices. At this time, this will
 	// never happen, because the selection of start-terms and joining
 	// terms never selects a term that is embedded inside a Choice. That
@@ -2105,6 +2128,8 @@ bool PatternMatchEngine::explore_term_branches(const PatternTermPtr& term,
                                                const Handle& hg,
                                                const PatternTermPtr& clause)
 {
+	_count.branches[QueryProfile::TERM_BRANCHES]++;
+
 	logmsg("Begin exploring term:", term);
 	bool found;
 	if (term->hasAnyGlobbyVar())
@@ -2133,6 +2158,8 @@ bool PatternMatchEngine::explore_choice_branches(const PatternTermPtr& ptm,
                                                  const Handle& hg,
                                                  const PatternTermPtr& clause)
 {
+	_count.branches[QueryProfile::CHOICE_BRANCHES]++;
+
 	throw RuntimeException(TRACE_INFO,
 		"Maybe this works but its not tested!! Find out!");
 
@@ -2241,6 +2268,8 @@ bool PatternMatchEngine::explore_present_branches(const PatternTermPtr& ptm,
                                                   const Handle& hg,
                                                   const PatternTermPtr& clause)
 {
+	_count.branches[QueryProfile::PRESENT_BRANCHES]++;
+
 	const Handle& hp = ptm->getHandle();
 
 	// Reject self-grounds.
@@ -2303,6 +2332,8 @@ bool PatternMatchEngine::explore_single_branch(const PatternTermPtr& ptm,
                                                const Handle& hg,
                                                const PatternTermPtr& clause)
 {
+	_count.branches[QueryProfile::SINGLE_BRANCH]++;
+
 	solution_push();
 
 	logmsg("ssss Checking term:", ptm);
@@ -2485,6 +2516,9 @@ bool PatternMatchEngine::clause_accept(const PatternTermPtr& clause,
 	}
 	if (not match) return false;
 
+	if (_pmc._profile)
+		_clause_prof[clause->getHandle()].groundings++;
+
 	if (not clause->hasAnyEvaluatable())
 	{
 		clause_grounding[clause_root] = hg;
@@ -2579,6 +2613,7 @@ bool PatternMatchEngine::do_next_clause(void)
 		}
 		found |= explore_clause(joiner, hgnd, do_clause);
 		clause_stacks_pop();
+		_count.backtracks++;
 
 		if (not _pmc.get_next_clause(do_clause, joiner)) break;
 		logmsg("This was a multiple-choice clause; looping around.");
@@ -2755,6 +2790,8 @@ void PatternMatchEngine::solution_drop(void)
 bool PatternMatchEngine::report_grounding(const GroundingMap &var_soln,
                                           const GroundingMap &term_soln)
 {
+	_count.solutions++;
+
 	// If the groundings need to be grouped together, pass that off to
 	// some out-of-line code.
 	if (_pat->grouping.size() > 0)
@@ -2872,6 +2909,8 @@ bool PatternMatchEngine::explore_neighborhood(const PatternTermPtr& term,
 	clause_stacks_clear();
 	clear_current_state();
 	_nack_cache.clear();
+	_clause_timer.clear();
+	_count.candidates++;
 
 	bool halt = explore_clause(term, grnd, clause);
 	bool stop = report_forall();
@@ -3109,6 +3148,9 @@ bool PatternMatchEngine::explore_clause(const PatternTermPtr& term,
                                         const Handle& grnd,
                                         const PatternTermPtr& pclause)
 {
+	_count.clause_tries++;
+	ClauseTimer timer(this, pclause);
+
 	// The two sides of an identity can be equated directly.
 	if (pclause->isIdentical())
 		return explore_clause_identical(term, grnd, pclause);
@@ -3166,6 +3208,7 @@ bool PatternMatchEngine::explore_clause(const PatternTermPtr& term,
 
 		// Record the clause grounding.
 		var_grounding[clause] = cac->second;
+		if (_pmc._profile) _clause_prof[clause].groundings++;
 
 		// Copy variable groundings, which were stored in the key.
 		// Usually, this is not needed; however, if the variable
@@ -3294,6 +3337,46 @@ PatternMatchEngine::PatternMatchEngine(PatternMatchCallback& pmcb)
 	_perm_odo_state.clear();
 }
 
+PatternMatchEngine::~PatternMatchEngine()
+{
+	if (_pmc._profile)
+		_pmc._profile->merge(_count, _clause_prof);
+}
+
+/* ======================================================== */
+
+/// Charge the time since the last mark to the clause on top of the
+/// timer stack, and start timing this one. Does nothing at all if
+/// the query is not being profiled.
+PatternMatchEngine::ClauseTimer::ClauseTimer(PatternMatchEngine* pme,
+                                             const PatternTermPtr& clause)
+	: _pme(nullptr)
+{
+	if (nullptr == pme->_pmc._profile) return;
+	_pme = pme;
+
+	auto now = std::chrono::steady_clock::now();
+	if (not pme->_clause_timer.empty())
+		pme->_clause_timer.back()->seconds +=
+			std::chrono::duration<double>(now - pme->_clause_mark).count();
+
+	QueryProfile::ClauseStats* cs = &pme->_clause_prof[clause->getHandle()];
+	cs->tries++;
+	pme->_clause_timer.push_back(cs);
+	pme->_clause_mark = now;
+}
+
+PatternMatchEngine::ClauseTimer::~ClauseTimer()
+{
+	if (nullptr == _pme or _pme->_clause_timer.empty()) return;
+
+	auto now = std::chrono::steady_clock::now();
+	_pme->_clause_timer.back()->seconds +=
+		std::chrono::duration<double>(now - _pme->_clause_mark).count();
+	_pme->_clause_timer.pop_back();
+	_pme->_clause_mark = now;
+}
+
 void PatternMatchEngine::set_pattern(const Variables& v,
                                      const Pattern& p)
 {
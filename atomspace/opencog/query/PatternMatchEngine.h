@@ -24,6 +24,7 @@
 #ifndef _OPENCOG_PATTERN_MATCH_ENGINE_H
 #define _OPENCOG_PATTERN_MATCH_ENGINE_H
 
+#include <chrono>
 #include <map>
 #include <set>
 #include <stack>
@@ -32,6 +33,7 @@
 #include <opencog/atoms/atom_types/NameServer.h>
 #include <opencog/atoms/pattern/Pattern.h>
 #include <opencog/query/PatternMatchCallback.h>
+#include <opencog/query/QueryProfile.h>
 
 namespace opencog {
 
@@ -315,8 +317,28 @@ private:
 	                const PatternTermPtr&);
 	bool clause_accept(const PatternTermPtr&, const Handle&);
 
+	// -------------------------------------------
+	// Instrumentation. The counters are always kept; they are added
+	// to the callback's profile, if there is one, in the destructor.
+	QueryProfile::Counters _count;
+
+	// Per-clause counts and times, kept only when profiling. The
+	// timer stack holds the clauses currently being explored; time
+	// is charged to the one on top.
+	QueryProfile::ClauseMap _clause_prof;
+	std::vector<QueryProfile::ClauseStats*> _clause_timer;
+	std::chrono::steady_clock::time_point _clause_mark;
+
+	struct ClauseTimer
+	{
+		PatternMatchEngine* _pme;
+		ClauseTimer(PatternMatchEngine*, const PatternTermPtr&);
+		~ClauseTimer();
+	};
+
 public:
 	PatternMatchEngine(PatternMatchCallback&);
+	~PatternMatchEngine();
 	void set_pattern(const Variables&, const Pattern&);
 
 	// Examine the locally connected neighborhood for possible
@@ -329,6 +351,9 @@ public:
 	// connected by an AndLink.
 	bool explore_constant_evaluatables(const PatternTermSeq& clauses);
 
+	// The work done so far.
+	const QueryProfile::Counters& get_counters(void) const { return _count; }
+
 	// Handy-dandy utilities
 	static void print_solution(const GroundingMap &vars,
 	                           const GroundingMap &clauses);
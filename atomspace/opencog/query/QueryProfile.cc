@@ -0,0 +1,138 @@
+/*
+ * QueryProfile.cc
+ *
+ * Copyright (C) 2026 OpenCog Foundation
+ * All Rights Reserved
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License v3 as
+ * published by the Free Software Foundation and including the exceptions
+ * at http://opencog.org/wiki/Licenses
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program; if not, write to:
+ * Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <opencog/atoms/base/Node.h>
+#include <opencog/atoms/value/FloatValue.h>
+#include <opencog/atoms/value/LinkValue.h>
+#include <opencog/atoms/value/StringValue.h>
+
+#include "QueryProfile.h"
+
+using namespace opencog;
+
+const char* QueryProfile::branch_name(Branch b)
+{
+	static const char* names[NUM_BRANCHES] = {
+		"up-branches",
+		"upord-branches",
+		"upund-branches",
+		"upspar-branches",
+		"upglob-branches",
+		"glob-branches",
+		"sparse-branches",
+		"type-branches",
+		"term-branches",
+		"odometer",
+		"unordered-branches",
+		"choice-branches",
+		"present-branches",
+		"single-branch",
+	};
+	return names[b];
+}
+
+QueryProfile::Counters&
+QueryProfile::Counters::operator+=(const Counters& other)
+{
+	candidates += other.candidates;
+	clause_tries += other.clause_tries;
+	tree_compares += other.tree_compares;
+	backtracks += other.backtracks;
+	perm_starts += other.perm_starts;
+	perm_steps += other.perm_steps;
+	solutions += other.solutions;
+	for (size_t i = 0; i < NUM_BRANCHES; i++)
+		branches[i] += other.branches[i];
+	return *this;
+}
+
+void QueryProfile::merge(const Counters& cnt, const ClauseMap& cls)
+{
+	std::lock_guard<std::mutex> lck(_mtx);
+	counts += cnt;
+	for (const auto& pr : cls)
+	{
+		ClauseStats& cs = clauses[pr.first];
+		cs.tries += pr.second.tries;
+		cs.groundings += pr.second.groundings;
+		cs.seconds += pr.second.seconds;
+	}
+}
+
+void QueryProfile::add_start(const Handle& clause, const Handle& term,
+                             size_t ncand)
+{
+	std::lock_guard<std::mutex> lck(_mtx);
+	starts.push_back({clause, term, ncand});
+}
+
+/* ======================================================== */
+
+static ValuePtr entry(const char* name, const ValuePtr& v)
+{
+	return createLinkValue(ValueSeq({createStringValue(name), v}));
+}
+
+static ValuePtr entry(const char* name, double x)
+{
+	return entry(name, createFloatValue(x));
+}
+
+ValuePtr QueryProfile::to_value(void) const
+{
+	ValueSeq vs;
+	vs.push_back(entry("seconds", seconds));
+	vs.push_back(entry("candidates", counts.candidates));
+	vs.push_back(entry("clause-tries", counts.clause_tries));
+	vs.push_back(entry("tree-compares", counts.tree_compares));
+	vs.push_back(entry("backtracks", counts.backtracks));
+	vs.push_back(entry("perm-starts", counts.perm_starts));
+	vs.push_back(entry("perm-steps", counts.perm_steps));
+	vs.push_back(entry("solutions", counts.solutions));
+	for (size_t i = 0; i < NUM_BRANCHES; i++)
+		vs.push_back(entry(branch_name((Branch) i), counts.branches[i]));
+
+	ValueSeq svs;
+	for (const Start& st : starts)
+		svs.push_back(createLinkValue(ValueSeq({st.clause, st.term,
+			createFloatValue((double) st.candidates)})));
+	vs.push_back(entry("starts", createLinkValue(std::move(svs))));
+
+	ValueSeq cvs;
+	for (const auto& pr : clauses)
+		cvs.push_back(createLinkValue(ValueSeq({pr.first,
+			createFloatValue(std::vector<double>({
+				(double) pr.second.tries,
+				(double) pr.second.groundings,
+				pr.second.seconds}))})));
+	vs.push_back(entry("clauses", createLinkValue(std::move(cvs))));
+
+	return createLinkValue(std::move(vs));
+}
+
+const Handle& QueryProfile::key(void)
+{
+	static Handle pk(createNode(PREDICATE_NODE, "*-QueryProfileKey-*"));
+	return pk;
+}
+
+/* ===================== END OF FILE ===================== */
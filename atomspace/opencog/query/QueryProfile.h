@@ -0,0 +1,130 @@
+/*
+ * QueryProfile.h
+ *
+ * Copyright (C) 2026 OpenCog Foundation
+ * All Rights Reserved
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License v3 as
+ * published by the Free Software Foundation and including the exceptions
+ * at http://opencog.org/wiki/Licenses
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program; if not, write to:
+ * Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#ifndef _OPENCOG_QUERY_PROFILE_H
+#define _OPENCOG_QUERY_PROFILE_H
+
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include <opencog/atoms/base/Handle.h>
+#include <opencog/atoms/value/Value.h>
+
+namespace opencog {
+
+/**
+ * A summary of the work done by the pattern matcher for one query.
+ *
+ * Every PatternMatchEngine keeps a set of Counters; these are plain
+ * integers, bumped as the search runs, and cost next to nothing. If a
+ * query is being profiled, then each engine adds its counters into
+ * the profile when it is done, and also records, for each clause, how
+ * many times a grounding for it was attempted, how many were found,
+ * and the time spent on it. The search initiator records the starting
+ * points it chose.
+ *
+ * A query is profiled if it has a Value (any Value) at the key
+ * `PredicateNode "*-QueryProfileKey-*"` when it is run. After it has
+ * run, that Value is replaced by the profile, as returned by
+ * `to_value()`.
+ */
+struct QueryProfile
+{
+	/// The explore_*_branches() methods of the PatternMatchEngine.
+	enum Branch
+	{
+		UP_BRANCHES,
+		UPORD_BRANCHES,
+		UPUND_BRANCHES,
+		UPSPAR_BRANCHES,
+		UPGLOB_BRANCHES,
+		GLOB_BRANCHES,
+		SPARSE_BRANCHES,
+		TYPE_BRANCHES,
+		TERM_BRANCHES,
+		ODOMETER,
+		UNORDERED_BRANCHES,
+		CHOICE_BRANCHES,
+		PRESENT_BRANCHES,
+		SINGLE_BRANCH,
+		NUM_BRANCHES
+	};
+	static const char* branch_name(Branch);
+
+	struct Counters
+	{
+		size_t candidates = 0;     // Starting points explored.
+		size_t clause_tries = 0;   // Attempts to ground a clause.
+		size_t tree_compares = 0;  // Calls to tree_compare().
+		size_t backtracks = 0;     // Retreats from a clause to the prior one.
+		size_t perm_starts = 0;    // Unordered links begun afresh.
+		size_t perm_steps = 0;     // Permutations tried.
+		size_t solutions = 0;      // Groundings reported to the callback.
+		size_t branches[NUM_BRANCHES] = {};
+
+		Counters& operator+=(const Counters&);
+	};
+
+	struct ClauseStats
+	{
+		size_t tries = 0;
+		size_t groundings = 0;
+		double seconds = 0.0;      // Not counting the clauses after it.
+	};
+	typedef std::map<Handle, ClauseStats> ClauseMap;
+
+	/// A starting point chosen by the search initiator: the clause,
+	/// the term in it where the search starts, and the number of
+	/// candidate groundings for that term.
+	struct Start
+	{
+		Handle clause;
+		Handle term;
+		size_t candidates;
+	};
+
+	Counters counts;
+	ClauseMap clauses;
+	std::vector<Start> starts;
+	double seconds = 0.0;
+
+	/// Thread-safe; the engines may run in parallel.
+	void merge(const Counters&, const ClauseMap&);
+	void add_start(const Handle& clause, const Handle& term, size_t);
+
+	/// The profile, as a LinkValue of (StringValue name, FloatValue)
+	/// pairs, followed by the pairs ("starts", LinkValue of (clause
+	/// term FloatValue)) and ("clauses", LinkValue of (clause
+	/// FloatValue tries groundings seconds)).
+	ValuePtr to_value(void) const;
+
+	/// `PredicateNode "*-QueryProfileKey-*"`
+	static const Handle& key(void);
+
+private:
+	std::mutex _mtx;
+};
+
+} // namespace opencog
+
+#endif // _OPENCOG_QUERY_PROFILE_H
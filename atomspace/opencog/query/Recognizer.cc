@@ -78,11 +78,33 @@ bool Recognizer::do_search(PatternMatchCallback& pmc, const Handle& top)
 	return false;
 }
 
+/// Match each clause, as a whole, against each of the candidates.
+bool Recognizer::candidate_search(PatternMatchCallback& pmc)
+{
+	PatternMatchEngine pme(pmc);
+	pme.set_pattern(*_variables, *_pattern);
+
+	for (const PatternTermPtr& ptm: _pattern->pmandatory)
+	{
+		_root = ptm;
+		for (const Handle& h : _candidates)
+		{
+			dbgprt("Indexed candidate (%lu):\n%s\n", _cnt++,
+			       h->to_short_string().c_str());
+			bool found = pme.explore_neighborhood(_root, h, _root);
+			if (found) return true;
+		}
+	}
+	return false;
+}
+
 bool Recognizer::perform_search(PatternMatchCallback& pmc)
 {
 	const PatternTermSeq& clauses = _pattern->pmandatory;
 
 	_cnt = 0;
+	if (_have_candidates) return candidate_search(pmc);
+
 	for (const PatternTermPtr& ptm: clauses)
 	{
 		_root = ptm;
@@ -57,7 +57,10 @@ class Recognizer :
 		PatternTermPtr _root;
 		PatternTermPtr _starter_term;
 		size_t _cnt;
+		HandleSeq _candidates;
+		bool _have_candidates;
 		bool do_search(PatternMatchCallback&, const Handle&);
+		bool candidate_search(PatternMatchCallback&);
 		bool loose_match(const Handle&, const Handle&);
 
 	public:
@@ -65,9 +68,18 @@ class Recognizer :
 
 		Recognizer(AtomSpace* as) :
 		    TermMatchMixin(as),
-		    _cnt(0)
+		    _cnt(0),
+		    _have_candidates(false)
 		{}
 
+		/// Consider only these atoms, instead of searching the
+		/// AtomSpace for them. See RuleIndex.
+		void set_candidates(HandleSeq&& cands)
+		{
+			_candidates = std::move(cands);
+			_have_candidates = true;
+		}
+
 		virtual bool node_match(const Handle&, const Handle&);
 		virtual bool link_match(const PatternTermPtr&, const Handle&);
 		virtual bool fuzzy_match(const Handle&, const Handle&);
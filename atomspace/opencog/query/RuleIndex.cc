@@ -0,0 +1,239 @@
+/*
+ * RuleIndex.cc
+ *
+ * Copyright (C) 2026 OpenCog Foundation
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License v3 as
+ * published by the Free Software Foundation and including the exceptions
+ * at http://opencog.org/wiki/Licenses
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program; if not, write to:
+ * Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <algorithm>
+
+#include <opencog/atoms/atom_types/NameServer.h>
+#include <opencog/atoms/core/FindUtils.h>
+#include <opencog/atoms/core/ScopeLink.h>
+#include <opencog/atoms/pattern/DualLink.h>
+
+#include "Recognizer.h"
+#include "RuleIndex.h"
+
+using namespace opencog;
+
+// The registered indexes, most recent last.
+static std::mutex _registry_mtx;
+static std::vector<std::pair<const AtomSpace*, std::weak_ptr<RuleIndex>>> _registry;
+
+RuleIndex::RuleIndex(AtomSpace* as, Type type)
+	: _as(as), _type(type), _dropped(0)
+{
+	if (not nameserver().isA(_type, QUERY_LINK))
+		throw InvalidParamException(TRACE_INFO,
+			"Expecting a QueryLink type, got %s",
+			nameserver().getTypeName(_type).c_str());
+
+	// Subscribe before scanning, so that nothing added in between
+	// is missed; insert() skips rules that are already indexed.
+	_feed = _as->subscribe_changes(1 << 16);
+	rebuild();
+}
+
+RuleIndex::~RuleIndex()
+{
+	// By now, the registry entry for this index (if any) has expired.
+	{
+		std::lock_guard<std::mutex> lck(_registry_mtx);
+		_registry.erase(std::remove_if(_registry.begin(), _registry.end(),
+			[](const auto& pr) { return pr.second.expired(); }),
+			_registry.end());
+	}
+	_as->unsubscribe_changes(_feed);
+}
+
+RuleIndexPtr opencog::createRuleIndex(AtomSpace* as, Type type)
+{
+	RuleIndexPtr idx(std::make_shared<RuleIndex>(as, type));
+	std::lock_guard<std::mutex> lck(_registry_mtx);
+	_registry.push_back({as, idx});
+	return idx;
+}
+
+RuleIndexPtr RuleIndex::get(const AtomSpace* as)
+{
+	std::lock_guard<std::mutex> lck(_registry_mtx);
+	for (auto it = _registry.rbegin(); it != _registry.rend(); it++)
+	{
+		if (it->first != as) continue;
+		RuleIndexPtr idx(it->second.lock());
+		if (idx) return idx;
+	}
+	return nullptr;
+}
+
+/* ======================================================== */
+
+/// Collect the links in the body, the body included. A target can
+/// match any of them; see the class description.
+static void collect_terms(const Handle& h, HandleSet& terms)
+{
+	if (not h->is_link()) return;
+	if (not terms.insert(h).second) return;
+	for (const Handle& o : h->getOutgoingSet())
+		collect_terms(o, terms);
+}
+
+void RuleIndex::insert(const Handle& rule)
+{
+	const Handle& body = ScopeLinkCast(rule)->get_body();
+	if (nullptr == body) return;
+
+	HandleSet terms;
+	collect_terms(body, terms);
+	for (const Handle& term : terms)
+	{
+		HandleSeq& rules = _rules[term];
+		if (std::find(rules.begin(), rules.end(), rule) != rules.end())
+			continue;
+		rules.push_back(rule);
+		if (1 == rules.size()) _tree.insert(term);
+	}
+}
+
+void RuleIndex::remove(const Handle& rule)
+{
+	const Handle& body = ScopeLinkCast(rule)->get_body();
+	if (nullptr == body) return;
+
+	HandleSet terms;
+	collect_terms(body, terms);
+	for (const Handle& term : terms)
+	{
+		auto it = _rules.find(term);
+		if (it == _rules.end()) continue;
+
+		HandleSeq& rules = it->second;
+		rules.erase(std::remove(rules.begin(), rules.end(), rule),
+		            rules.end());
+		if (not rules.empty()) continue;
+
+		_rules.erase(it);
+		_tree.remove(term);
+	}
+}
+
+void RuleIndex::scan(void)
+{
+	_rules.clear();
+	_tree.clear();
+
+	HandleSeq rules;
+	_as->get_handles_by_type(rules, _type, true);
+	for (const Handle& h : rules)
+		insert(h);
+}
+
+/// Apply the queued change events. If any were dropped, the index
+/// can no longer be trusted, and is rebuilt.
+void RuleIndex::drain(void)
+{
+	std::vector<AtomEvent> batch;
+	_feed->drain(batch);
+
+	size_t dropped = _feed->dropped();
+	if (dropped != _dropped)
+	{
+		_dropped = dropped;
+		scan();
+		return;
+	}
+
+	for (const AtomEvent& ev : batch)
+	{
+		if (not nameserver().isA(ev.atom->get_type(), _type)) continue;
+		if (AtomEvent::ADDED == ev.kind) insert(ev.atom);
+		else if (AtomEvent::EXTRACTED == ev.kind) remove(ev.atom);
+	}
+}
+
+void RuleIndex::update(void)
+{
+	std::lock_guard<std::mutex> lck(_mtx);
+	drain();
+}
+
+void RuleIndex::rebuild(void)
+{
+	std::lock_guard<std::mutex> lck(_mtx);
+
+	// Anything already queued is covered by the scan.
+	std::vector<AtomEvent> stale;
+	_feed->drain(stale);
+	_dropped = _feed->dropped();
+	scan();
+}
+
+size_t RuleIndex::size(void)
+{
+	std::lock_guard<std::mutex> lck(_mtx);
+	drain();
+	return _rules.size();
+}
+
+/* ======================================================== */
+
+HandleSeq RuleIndex::get_candidates(const Handle& target)
+{
+	std::lock_guard<std::mutex> lck(_mtx);
+	drain();
+
+	HandleSeq cands;
+
+	// A ChoiceLink in the target matches in more than one way; the
+	// tree can't follow that, so every rule is a candidate.
+	if (contains_atomtype(target, CHOICE_LINK))
+	{
+		for (const auto& pr : _rules)
+			cands.push_back(pr.first);
+		return cands;
+	}
+
+	_tree.lookup(target, cands);
+	return cands;
+}
+
+HandleSeq RuleIndex::get_terms(const Handle& target)
+{
+	Recognizer reco(_as);
+	reco.set_candidates(get_candidates(target));
+	reco.satisfy(createDualLink(HandleSeq({target})));
+	return HandleSeq(reco._rules.begin(), reco._rules.end());
+}
+
+HandleSeq RuleIndex::get_rules(const Handle& target)
+{
+	HandleSeq terms(get_terms(target));
+
+	// A rule may have several terms that match.
+	std::lock_guard<std::mutex> lck(_mtx);
+	HandleSet rules;
+	for (const Handle& term : terms)
+	{
+		auto it = _rules.find(term);
+		if (it == _rules.end()) continue;
+		rules.insert(it->second.begin(), it->second.end());
+	}
+	return HandleSeq(rules.begin(), rules.end());
+}
+
+/* ===================== END OF FILE ===================== */
@@ -0,0 +1,126 @@
+/*
+ * RuleIndex.h
+ *
+ * Copyright (C) 2026 OpenCog Foundation
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License v3 as
+ * published by the Free Software Foundation and including the exceptions
+ * at http://opencog.org/wiki/Licenses
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program; if not, write to:
+ * Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#ifndef _OPENCOG_RULE_INDEX_H
+#define _OPENCOG_RULE_INDEX_H
+
+#include <mutex>
+#include <unordered_map>
+
+#include <opencog/atomspace/AtomSpace.h>
+#include <opencog/query/DiscriminationTree.h>
+
+namespace opencog {
+
+class RuleIndex;
+typedef std::shared_ptr<RuleIndex> RuleIndexPtr;
+
+/**
+ * An index of the rules in an AtomSpace, by the shape of their bodies,
+ * for pattern recognition at scale.
+ *
+ * The Recognizer, used by the DualLink, finds candidate patterns by
+ * walking up the incoming sets of the nodes in the target. Nodes that
+ * are common to many rules (a predicate, a word like "I") have huge
+ * incoming sets, and every rule in them gets pattern-matched. This
+ * index instead keeps the terms of the bodies of all of the QueryLinks
+ * (and so BindLinks) in a DiscriminationTree, and asks it for
+ * candidates; the cost then follows the size of the target, not the
+ * number of rules.
+ *
+ * Every link in a body is indexed: the body itself, each clause of an
+ * AndLink or PresentLink, and everything below those. This is what
+ * the Recognizer would find by walking incoming sets, and so a target
+ * that matches one clause of a multi-clause rule finds that clause.
+ *
+ * The index made with createRuleIndex() is registered for its
+ * AtomSpace, and executing a DualLink in that AtomSpace uses it. Note
+ * that this narrows what the DualLink finds: without an index, any
+ * atom with variables in it can be recognized; with one, only those
+ * inside rule bodies can. An index made directly with the constructor
+ * is not registered, and does not affect the DualLink.
+ *
+ * The index follows the AtomSpace change feed, and picks up rules that
+ * were added or extracted since the last lookup. Should the feed
+ * overflow, the index is rebuilt from scratch. Clearing the AtomSpace
+ * is not reported by the feed; call rebuild() after doing that.
+ */
+class RuleIndex
+{
+public:
+	RuleIndex(AtomSpace*, Type type = QUERY_LINK);
+	~RuleIndex();
+
+	RuleIndex(const RuleIndex&) = delete;
+	RuleIndex& operator=(const RuleIndex&) = delete;
+
+	/// The rule terms that might match the target; these still need
+	/// to be checked, e.g. by the Recognizer.
+	HandleSeq get_candidates(const Handle& target);
+
+	/// The rule terms that do match the target. This is what the
+	/// DualLink returns.
+	HandleSeq get_terms(const Handle& target);
+
+	/// The rules having a term that matches the target.
+	HandleSeq get_rules(const Handle& target);
+
+	/// Apply the pending changes from the AtomSpace. This is done
+	/// automatically by the lookups.
+	void update(void);
+
+	/// Drop everything, and index the AtomSpace afresh.
+	void rebuild(void);
+
+	/// Number of distinct rule terms in the index.
+	size_t size(void);
+
+	/// The registered index for the AtomSpace, if any; the one most
+	/// recently created, if there are several. The caller shares
+	/// ownership, so the index stays alive while it is in use.
+	static RuleIndexPtr get(const AtomSpace*);
+
+private:
+	AtomSpace* _as;
+	Type _type;
+
+	ChangeSubscriberPtr _feed;
+	size_t _dropped;
+
+	std::mutex _mtx;
+	DiscriminationTree _tree;
+
+	// The rules having each term. Many rules may share one term.
+	std::unordered_map<Handle, HandleSeq> _rules;
+
+	void insert(const Handle&);
+	void remove(const Handle&);
+	void scan(void);
+	void drain(void);
+};
+
+/// Make an index, and register it for the AtomSpace. It stays
+/// registered until the last reference to it is dropped.
+RuleIndexPtr createRuleIndex(AtomSpace*, Type = QUERY_LINK);
+
+} // namespace opencog
+
+#endif // _OPENCOG_RULE_INDEX_H
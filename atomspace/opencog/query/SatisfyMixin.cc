@@ -21,6 +21,8 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
  */
 
+#include <chrono>
+
 #include <opencog/util/oc_assert.h>
 #include <opencog/util/Logger.h>
 
@@ -44,7 +46,10 @@ class PMCGroundings : public SatisfyMixin
 		PatternMatchCallback& _cb;
 
 	public:
-		PMCGroundings(PatternMatchCallback& cb) : _cb(cb) {}
+		PMCGroundings(PatternMatchCallback& cb) : _cb(cb)
+		{
+			_profile = cb._profile;
+		}
 
 		// Pass all the calls straight through, except one.
 		bool node_match(const Handle& node1, const Handle& node2) {
@@ -372,6 +377,11 @@ bool SatisfyMixin::cartesian_product(
  */
 bool SatisfyMixin::satisfy(const PatternLinkPtr& form)
 {
+	// Profile the search, if asked to. The searches for the
+	// components, below, add to the same profile.
+	if (nullptr == _profile and nullptr != form->getValue(QueryProfile::key()))
+		return profile(form);
+
 	PatternLinkPtr jit = form->jit_analyze();
 
 	const Variables& vars = jit->get_variables();
@@ -557,4 +567,38 @@ bool SatisfyMixin::satisfy(const PatternLinkPtr& form)
 	return done;
 }
 
+/* ================================================================= */
+
+/// Run the search, collecting a QueryProfile, and then place the
+/// profile on the query, at the key that asked for it.
+bool SatisfyMixin::profile(const PatternLinkPtr& form)
+{
+	QueryProfile prof;
+	_profile = &prof;
+
+	auto start = std::chrono::steady_clock::now();
+	bool found;
+	try
+	{
+		found = SatisfyMixin::satisfy(form);
+	}
+	catch (...)
+	{
+		_profile = nullptr;
+		throw;
+	}
+	_profile = nullptr;
+	prof.seconds = std::chrono::duration<double>(
+		std::chrono::steady_clock::now() - start).count();
+
+	const Handle& self(form->get_handle());
+	AtomSpace* as = form->getAtomSpace();
+	if (as)
+		as->set_value(self, QueryProfile::key(), prof.to_value());
+	else
+		form->setValue(QueryProfile::key(), prof.to_value());
+
+	return found;
+}
+
 /* ===================== END OF FILE ===================== */
@@ -39,6 +39,8 @@ class SatisfyMixin:
 	                       GroundingMapSeqSeq comp_var_gnds,
 	                       GroundingMapSeqSeq comp_term_gnds);
 
+	bool profile(const PatternLinkPtr&);
+
 	public:
 		virtual bool satisfy(const PatternLinkPtr&);
 };
@@ -66,6 +66,7 @@ cog-link
 cog-link?
 cog-map-type
 cog-mean
+cog-memory-usage
 cog-name
 cog-new-ast
 cog-new-atom
@@ -83,6 +84,7 @@ cog-set-atomspace!
 cog-set-server-mode!
 cog-set-tv!
 cog-set-value!
+cog-set-value-column!
 cog-set-value-ref!
 cog-set-values!
 cog-subtype?
@@ -94,10 +96,12 @@ cog-tv-merge
 cog-tv-merge-hi-conf
 cog-type
 cog-type->int
+cog-type-value-column
 cog-update-value!
 cog-value
 cog-value?
 cog-value->list
+cog-value-column
 cog-value-ref
 cog-value-type
 )
@@ -1043,6 +1043,69 @@
        cog-inc-value! - Increment one location in a vector.
 ")
 
+(set-procedure-property! cog-value-column 'documentation
+"
+ cog-value-column ATOM-LIST KEY [N]
+    Return an f64vector holding the N'th entry of the value at KEY,
+    for each atom in ATOM-LIST. If N is absent, it is zero. The value
+    must be a FloatValue (or TruthValue) or a NumberNode; if an atom
+    has no such value at KEY, or it is too short, the entry is NaN.
+
+    This is the same as
+        (list->f64vector (map (lambda (a) (cog-value-ref a KEY N)) ATOM-LIST))
+    except that it is done in one call, and is thus much faster for
+    long lists.
+
+    Example:
+       guile> (cog-set-value! (Concept \"a\") (Predicate \"k\") (FloatValue 1 2))
+       guile> (cog-set-value! (Concept \"b\") (Predicate \"k\") (FloatValue 3 4))
+       guile> (cog-value-column (list (Concept \"a\") (Concept \"b\"))
+                 (Predicate \"k\") 1)
+       #f64(2.0 4.0)
+
+    See also:
+       cog-type-value-column - Same, for all atoms of one type.
+       cog-set-value-column! - Set a value on many atoms at once.
+")
+
+(set-procedure-property! cog-type-value-column 'documentation
+"
+ cog-type-value-column TYPE KEY [N [ATOMSPACE]]
+    Return a pair. The car is a list of all of the atoms of type TYPE
+    in the ATOMSPACE; the cdr is an f64vector holding the N'th entry
+    of the value at KEY on each of these atoms, in the same order.
+    See cog-value-column for details.
+
+    This replaces a loop over cog-map-type, calling cog-value-ref on
+    each atom. The ATOMSPACE argument is optional; if absent, the
+    default AtomSpace for this thread is used.
+
+    Example:
+       guile> (define col (cog-type-value-column 'ConceptNode (Predicate \"k\")))
+       guile> (car col)
+       ((ConceptNode \"a\") (ConceptNode \"b\"))
+       guile> (cdr col)
+       #f64(1.0 3.0)
+")
+
+(set-procedure-property! cog-set-value-column! 'documentation
+"
+ cog-set-value-column! ATOM-LIST KEY VECTOR
+    For each atom in ATOM-LIST, set the value at KEY to a FloatValue
+    holding the corresponding number in VECTOR. VECTOR may be an
+    f64vector or a list of numbers; it must be the same length as
+    ATOM-LIST. Returns the list of atoms.
+
+    This is the same as calling cog-set-value! on each atom, but in
+    one call, and so is much faster for long lists.
+
+    Example:
+       guile> (cog-set-value-column! (list (Concept \"a\") (Concept \"b\"))
+                 (Predicate \"k\") (f64vector 0.5 0.25))
+       guile> (cog-value (Concept \"b\") (Predicate \"k\"))
+       (FloatValue 0.25)
+")
+
 (set-procedure-property! cog-get-types 'documentation
 "
  cog-get-types
@@ -1139,6 +1202,38 @@
      cog-report-counts -- return a report of counts of all atom types.
 ")
 
+(set-procedure-property! cog-memory-usage 'documentation
+"
+ cog-memory-usage [TOP-N [SAMPLE [ATOMSPACE]]]
+    Return an association list estimating how many bytes of RAM the
+    atoms in ATOMSPACE use. If ATOMSPACE is absent, the current
+    atomspace is used; base atomspaces are not included. The entries
+    are:
+
+      (total COUNT ATOM-BYTES VALUE-BYTES INCOMING-BYTES INDEX-BYTES)
+      (types (TYPE COUNT ATOM-BYTES VALUE-BYTES INCOMING-BYTES INDEX-BYTES) ...)
+      (keys (KEY COUNT BYTES) ...)
+      (largest-incoming (ATOM . SIZE) ...)
+
+    ATOM-BYTES are the atoms themselves, with their names or outgoing
+    sets; VALUE-BYTES are all of the values on them; INCOMING-BYTES
+    their incoming sets, and INDEX-BYTES the atomspace index. Under
+    `keys`, COUNT is the number of atoms having a value at KEY. The
+    last entry lists the TOP-N atoms with the largest incoming sets,
+    largest first; TOP-N defaults to 10.
+
+    This looks at every atom. For very large atomspaces, give a SAMPLE
+    greater than one, to look at only one atom out of every SAMPLE,
+    and scale up the results.
+
+    Example:
+       ; The five atoms with the largest incoming sets.
+       guile> (assoc-ref (cog-memory-usage 5) 'largest-incoming)
+
+    See also:
+       cog-report-counts -- return a report of counts of all atom types.
+")
+
 (set-procedure-property! cog-atomspace 'documentation
 "
  cog-atomspace [ATOM]
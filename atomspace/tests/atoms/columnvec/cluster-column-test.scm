@@ -0,0 +1,73 @@
+;
+; cluster-column-test.scm -- Verify that ClusterColumn works.
+;
+(use-modules (opencog) (opencog exec))
+(use-modules (opencog test-runner))
+
+(opencog-test-runner)
+(define tname "cluster-column-test")
+(test-begin tname)
+
+; The cluster ids are arbitrary; only which rows share one matters.
+(define (same-cluster? ids i j)
+	(equal? (list-ref ids i) (list-ref ids j)))
+
+; ------------------------------------------------------------
+; Two blobs, in rows.
+(define table
+	(List
+		(Number 0 0)
+		(Number 9 9)
+		(Number 0 1)
+		(Number 9 8)
+		(Number 1 0)))
+
+(define kmeans (cog-value->list
+	(cog-execute! (ClusterColumn (TransposeColumn table) (Number 2)))))
+
+(format #t "Got kmeans ~A\n" kmeans)
+
+(test-equal "kmeans length" 5 (length kmeans))
+(test-assert "kmeans a" (same-cluster? kmeans 0 2))
+(test-assert "kmeans b" (same-cluster? kmeans 0 4))
+(test-assert "kmeans c" (same-cluster? kmeans 1 3))
+(test-assert "kmeans d" (not (same-cluster? kmeans 0 1)))
+
+(define tree (cog-value->list
+	(cog-execute! (TreeClusterColumn (TransposeColumn table) (Number 2)))))
+
+(format #t "Got tree ~A\n" tree)
+
+(test-assert "tree a" (same-cluster? tree 0 2))
+(test-assert "tree b" (same-cluster? tree 0 4))
+(test-assert "tree c" (same-cluster? tree 1 3))
+(test-assert "tree d" (not (same-cluster? tree 0 1)))
+
+; ------------------------------------------------------------
+; Attach the ids to the Atoms the rows came from.
+(define items
+	(List (Concept "a") (Concept "b") (Concept "c") (Concept "d") (Concept "e")))
+(define key (Predicate "cluster"))
+
+(define ids (cog-value->list
+	(cog-execute! (ClusterColumn (TransposeColumn table) (Number 2 3)
+		items key))))
+
+(test-equal "attached a" (list (list-ref ids 0))
+	(cog-value->list (cog-value (Concept "a") key)))
+(test-equal "attached d" (list (list-ref ids 3))
+	(cog-value->list (cog-value (Concept "d") key)))
+
+; ------------------------------------------------------------
+; The rows must all be there.
+(test-assert "short column"
+	(catch #t
+		(lambda ()
+			(cog-execute! (ClusterColumn
+				(List (Number 1 2 3) (Number 4 5)) (Number 2)))
+			#f)
+		(lambda (key . args) #t)))
+
+; ------------------------------------------------------------
+(test-end tname)
+(opencog-test-end)
@@ -1,3 +1,4 @@
+import array
 import unittest
 
 from opencog.type_constructors import *
@@ -41,6 +42,24 @@ class FloatValueTest(unittest.TestCase):
         value = FloatValue([1.0, 2.0, 3.0])
         self.assertEqual([1.0, 2.0, 3.0], value.to_list())
 
+    def test_buffer_protocol(self):
+        value = FloatValue([1.0, 2.0, 3.0])
+        view = memoryview(value)
+        self.assertEqual('d', view.format)
+        self.assertTrue(view.readonly)
+        self.assertEqual((3,), view.shape)
+        self.assertEqual([1.0, 2.0, 3.0], view.tolist())
+
+    def test_create_from_buffer(self):
+        data = array.array('d', [0.5 * i for i in range(10000)])
+        value = FloatValue(data)
+        self.assertEqual(data.tolist(), value.to_list())
+        self.assertEqual(FloatValue([]), FloatValue(array.array('d')))
+
+        # Buffers that are not doubles get converted.
+        self.assertEqual(FloatValue([1.0, 2.0]),
+                         FloatValue(array.array('i', [1, 2])))
+
     def test_str(self):
         value = FloatValue(1.234)
         self.assertEqual('(FloatValue 1.234)', str(value))
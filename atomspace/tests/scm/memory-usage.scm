@@ -0,0 +1,47 @@
+;
+; memory-usage.scm -- Unit test for cog-memory-usage.
+;
+(use-modules (opencog))
+(use-modules (opencog test-runner))
+
+; ---------------------------------------------------------------------
+(opencog-test-runner)
+(define tname "memory_usage")
+(test-begin tname)
+
+(define key (Predicate "vector"))
+(define hub (Concept "hub"))
+(for-each
+	(lambda (i)
+		(define word (Concept (number->string i)))
+		(List hub word)
+		(cog-set-value! word key (FloatValue 1 2 3 4 5 6 7 8)))
+	(iota 20))
+
+(define report (cog-memory-usage 3))
+
+; Counts per type are exact.
+(define concepts (assoc-ref (assoc-ref report 'types) 'ConceptNode))
+(test-equal "concept count" 21 (car concepts))
+(test-equal "list count" 20
+	(car (assoc-ref (assoc-ref report 'types) 'ListLink)))
+(test-equal "total count" (count-all) (car (assoc-ref report 'total)))
+
+; The vectors were counted under their key.
+(define vecs (assoc-ref (assoc-ref report 'keys) key))
+(test-equal "key count" 20 (car vecs))
+(test-assert "key bytes" (< (* 20 8 8) (cadr vecs)))
+
+; The hub comes first.
+(define hubs (assoc-ref report 'largest-incoming))
+(test-equal "three hubs" 3 (length hubs))
+(test-equal "hub" (cons hub 20) (car hubs))
+
+; Sampling keeps the counts.
+(define sampled (cog-memory-usage 3 4))
+(test-equal "sampled count" 21
+	(car (assoc-ref (assoc-ref sampled 'types) 'ConceptNode)))
+
+(test-end tname)
+
+(opencog-test-end)
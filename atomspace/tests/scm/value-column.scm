@@ -0,0 +1,52 @@
+;
+; value-column.scm -- Unit test for bulk access to Values.
+;
+(use-modules (srfi srfi-4))
+(use-modules (opencog))
+(use-modules (opencog test-runner))
+
+; ---------------------------------------------------------------------
+(opencog-test-runner)
+(define tname "value_column")
+(test-begin tname)
+
+(define key (Predicate "count"))
+(define atoms (map (lambda (i) (Concept (number->string i))) (iota 100)))
+
+; Set a value on every atom, in one go.
+(cog-set-value-column! atoms key
+	(list->f64vector (map (lambda (i) (* 0.5 i)) (iota 100))))
+
+(test-assert "set one"
+	(equal? (cog-value (Concept "42") key) (FloatValue 21)))
+
+; Read them back, in one go.
+(define col (cog-value-column atoms key))
+(test-assert "column length" (equal? 100 (f64vector-length col)))
+(test-assert "column entry" (equal? 49.5 (f64vector-ref col 99)))
+
+; Missing values, and short vectors, read as NaN.
+(cog-set-value! (Concept "7") key (FloatValue 1 2 3))
+(define col2 (cog-value-column (list (Concept "7") (Concept "none")) key 2))
+(test-assert "second entry" (equal? 3.0 (f64vector-ref col2 0)))
+(test-assert "missing" (nan? (f64vector-ref col2 1)))
+
+; By type: the atoms and the values come back in the same order.
+(define tcol (cog-type-value-column 'ConceptNode key))
+(test-assert "type length"
+	(equal? (length (car tcol)) (f64vector-length (cdr tcol))))
+(test-assert "type order"
+	(equal? (cog-value-ref (list-ref (car tcol) 10) key 0)
+		(f64vector-ref (cdr tcol) 10)))
+
+; A plain list works too; mismatched lengths are an error.
+(cog-set-value-column! (list (Concept "a") (Concept "b")) key '(1 2))
+(test-assert "list" (equal? (cog-value (Concept "b") key) (FloatValue 2)))
+(test-assert "mismatch"
+	(catch #t
+		(lambda () (cog-set-value-column! atoms key (f64vector 1 2)) #f)
+		(lambda (key . args) #t)))
+
+(test-end tname)
+
+(opencog-test-end)
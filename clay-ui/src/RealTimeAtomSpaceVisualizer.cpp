@@ -38,6 +38,8 @@ namespace opencog {
 // Constructor
 RealTimeAtomSpaceVisualizer::RealTimeAtomSpaceVisualizer()
     : _atomspace(nullptr),
+      _droppedEvents(0),
+      _resyncPending(false),
       _processingEvents(false),
       _layoutMode(LayoutMode::FORCE_DIRECTED),
       _colorMode(ColorMode::TYPE_BASED),
@@ -85,18 +87,10 @@ void RealTimeAtomSpaceVisualizer::connectToAtomSpace(AtomSpacePtr atomspace)
     _atomspace = atomspace;
     
     if (_atomspace != nullptr) {
-        // Register for AtomSpace change events
-        // This uses the AtomSpace signals mechanism
-        // Pseudocode - actual implementation would differ based on AtomSpace API
-        //_atomspace->addAtomSignal(
-        //    std::bind(&RealTimeAtomSpaceVisualizer::handleAtomAdded, this, std::placeholders::_1)
-        //);
-        //_atomspace->removeAtomSignal(
-        //    std::bind(&RealTimeAtomSpaceVisualizer::handleAtomRemoved, this, std::placeholders::_1)
-        //);
-        //_atomspace->TVChangedSignal(
-        //    std::bind(&RealTimeAtomSpaceVisualizer::handleAtomModified, this, std::placeholders::_1)
-        //);
+        // Register for AtomSpace change events. The update thread
+        // drains them in batches; see pollChangeFeed().
+        _changeSubscriber = _atomspace->subscribe_changes();
+        _droppedEvents = 0;
         
         // Start the update thread
         startUpdateThread();
@@ -109,15 +103,13 @@ void RealTimeAtomSpaceVisualizer::connectToAtomSpace(AtomSpacePtr atomspace)
 void RealTimeAtomSpaceVisualizer::disconnectFromAtomSpace()
 {
     if (_atomspace != nullptr) {
-        // Unregister from AtomSpace signals
-        // Pseudocode - actual implementation would differ based on AtomSpace API
-        //_atomspace->removeAtomSignal(...);
-        //_atomspace->removeAtomSignal(...);
-        //_atomspace->TVChangedSignal(...);
-        
         // Stop the update thread
         stopUpdateThread();
         
+        // Unregister from AtomSpace change events
+        _atomspace->unsubscribe_changes(_changeSubscriber);
+        _changeSubscriber = nullptr;
+        
         _atomspace = nullptr;
     }
 }
@@ -321,8 +313,40 @@ bool RealTimeAtomSpaceVisualizer::exportToJSON(const std::string& filename)
 }
 
 // Event handling
+void RealTimeAtomSpaceVisualizer::pollChangeFeed()
+{
+    if (!_changeSubscriber) return;
+    
+    std::vector<AtomEvent> batch;
+    _changeSubscriber->drain(batch);
+    
+    // If the feed overflowed, some changes were missed. Don't patch
+    // up the renderer; this thread doesn't own it. Ask the render
+    // thread to reload it from the AtomSpace instead.
+    size_t dropped = _changeSubscriber->dropped();
+    if (dropped != _droppedEvents) {
+        _droppedEvents = dropped;
+        _resyncPending = true;
+    }
+    
+    if (batch.empty()) return;
+    
+    unsigned long now = duration_cast<milliseconds>(
+        system_clock::now().time_since_epoch()).count();
+    
+    std::lock_guard<std::mutex> lock(_eventMutex);
+    for (AtomEvent& ev : batch) {
+        ChangeType type = ChangeType::MODIFIED;
+        if (ev.kind == AtomEvent::ADDED) type = ChangeType::ADDED;
+        else if (ev.kind == AtomEvent::EXTRACTED) type = ChangeType::REMOVED;
+        _pendingEvents.push({std::move(ev.atom), type, now});
+    }
+}
+
 void RealTimeAtomSpaceVisualizer::processPendingEvents()
 {
+    pollChangeFeed();
+    
     std::queue<ChangeEvent> eventsToProcess;
     
     // Get all pending events under lock
@@ -434,13 +458,7 @@ void RealTimeAtomSpaceVisualizer::updateVisualization()
         _renderer->setRenderConfig(config);
         
         // Set initial atoms if connected to AtomSpace
-        if (isConnected()) {
-            HandleSeq atoms;
-            // Get all atoms from the AtomSpace
-            // Actual implementation would depend on AtomSpace API
-            // _atomspace->get_handles_by_type(atoms, ATOM, true);
-            _renderer->setAtoms(atoms);
-        }
+        resyncRenderer();
         
         // Initialize the renderer with default viewport size
         _renderer->initialize(_viewportWidth, _viewportHeight);
@@ -473,6 +491,16 @@ void RealTimeAtomSpaceVisualizer::updateVisualization()
     }
 }
 
+void RealTimeAtomSpaceVisualizer::resyncRenderer()
+{
+    if (!_renderer || !isConnected()) return;
+    
+    HandleSeq atoms;
+    _atomspace->get_handles_by_type(atoms, ATOM, true);
+    _renderer->setAtoms(atoms);
+    _needsRedraw = true;
+}
+
 bool RealTimeAtomSpaceVisualizer::isAtomVisible(const Handle& h) const
 {
     if (!isConnected() || h == Handle::UNDEFINED) return false;
@@ -637,6 +665,11 @@ void RealTimeAtomSpaceVisualizer::setViewportSize(int width, int height)
 
 void RealTimeAtomSpaceVisualizer::render()
 {
+    // Reload everything, if the change feed overflowed.
+    if (_resyncPending.exchange(false)) {
+        resyncRenderer();
+    }
+    
     if (_renderer) {
         _renderer->render(_viewportWidth, _viewportHeight);
     }
@@ -38,6 +38,7 @@ namespace opencog {
 class AtomSpace;
 class Handle;
 class Atom;
+class ChangeSubscriber;
 
 /**
  * RealTimeAtomSpaceVisualizer - Provides real-time visualization of changes to the AtomSpace
@@ -139,6 +140,9 @@ private:
     AtomSpacePtr _atomspace;
     
     // Change notification handling
+    std::shared_ptr<ChangeSubscriber> _changeSubscriber;
+    size_t _droppedEvents;
+    std::atomic<bool> _resyncPending;
     std::mutex _eventMutex;
     std::queue<ChangeEvent> _pendingEvents;
     std::atomic<bool> _processingEvents;
@@ -170,6 +174,8 @@ private:
     void startUpdateThread();
     void stopUpdateThread();
     void updateVisualization();
+    void pollChangeFeed();
+    void resyncRenderer();
     bool isAtomVisible(const Handle& h) const;
     void handleAtomAdded(const Handle& h);
     void handleAtomRemoved(const Handle& h);
@@ -39,7 +39,7 @@ BuiltinRequestsModule::BuiltinRequestsModule(CogServer& cs) : Module(cs)
     do_dot_register();
 
     do_stats_register();
-
+    do_memory_register();
 }
 
 BuiltinRequestsModule::~BuiltinRequestsModule()
@@ -55,6 +55,7 @@ BuiltinRequestsModule::~BuiltinRequestsModule()
     do_dot_unregister();
 
     do_stats_unregister();
+    do_memory_unregister();
 
     _cogserver.unregisterRequest(ShutdownRequest::info().id);
     _cogserver.unregisterRequest(ConfigModuleRequest::info().id);
@@ -165,3 +166,22 @@ std::string BuiltinRequestsModule::do_stats(Request *req, std::list<std::string>
 }
 
 // ====================================================================
+// Print the RAM used by the AtomSpace.
+std::string BuiltinRequestsModule::do_memory(Request *req, std::list<std::string> args)
+{
+    size_t top_n = 10;
+    size_t sample = 1;
+    try {
+        if (0 < args.size()) top_n = std::stoul(args.front());
+        if (1 < args.size()) sample = std::stoul(*std::next(args.begin()));
+    }
+    catch (const std::exception&) {
+        return do_memoryRequest::info().help;
+    }
+    if (2 < args.size())
+        return do_memoryRequest::info().help;
+
+    return _cogserver.getAtomSpace()->get_memory_usage(top_n, sample).to_string();
+}
+
+// ====================================================================
@@ -90,6 +90,18 @@ DECLARE_CMD_REQUEST(BuiltinRequestsModule, "stats", do_stats,
        "Usage: stats\n\n" + CogServer::stats_legend(),
        false, false)
 
+DECLARE_CMD_REQUEST(BuiltinRequestsModule, "memory", do_memory,
+       "Print an estimate of the RAM used by the AtomSpace.",
+       "Usage: memory [<top-n> [<sample>]]\n\n"
+       "Print the number of Atoms of each type, and the bytes used by\n"
+       "the Atoms, by the Values on them, by their incoming sets, and\n"
+       "by the AtomSpace index. Then print the bytes used by the Values\n"
+       "under each key, and the <top-n> Atoms with the largest incoming\n"
+       "sets; <top-n> is 10 by default. With a <sample> greater than 1,\n"
+       "only one Atom out of every <sample> is looked at, and the byte\n"
+       "counts are scaled up. This is faster, for large AtomSpaces.\n",
+       false, false)
+
 public:
     static const char* id();
     BuiltinRequestsModule(CogServer&);
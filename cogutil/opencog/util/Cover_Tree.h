@@ -30,9 +30,12 @@
 #include <iostream>
 #include <map>
 #include <set>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include <opencog/util/parallel_for.h>
+
 /** \addtogroup grp_cogutil
  *  @{
  */
@@ -88,6 +91,20 @@
  * If you do not want to allow multiple nodes with distance 0, then just make
  * your equality operator always return true when distance is 0.
  *
+ * The Point class may also define
+ *
+ * @code
+ * double YourPoint::distance(const YourPoint& p, double bound) const;
+ * @endcode
+ *
+ * which may stop as soon as the distance is known to exceed `bound`,
+ * returning any value greater than `bound`; below it, it must return
+ * the exact distance. If present, the tree uses it wherever only
+ * nearby points matter. For long vectors, this skips most of the work
+ * of most distance calls.
+ *
+ * The batch functions run on several threads; for those, distance()
+ * must be safe to call concurrently.
  */
 template<class Point>
 class CoverTree
@@ -141,8 +158,36 @@ class CoverTree
                   //between any 2 points
     int _minLevel;//A level beneath which there are no more new nodes.
 
+    /**
+     * The k nearest nodes to p. The search starts out with the seed
+     * nodes as the best known, which prunes it much sooner, if they
+     * are near p.
+     */
     std::vector<CoverTreeNode*>
-        k_nearest_nodes(const Point& p, const unsigned int& k) const;
+        k_nearest_nodes(const Point& p, const unsigned int& k,
+                        const std::vector<CoverTreeNode*>& seed =
+                        std::vector<CoverTreeNode*>()) const;
+
+    /**
+     * The points of the nodes, in order, up to k of them (or more,
+     * if the last node has several).
+     */
+    static std::vector<Point>
+        collect_points(const std::vector<CoverTreeNode*>& nodes,
+                       const unsigned int& k);
+
+    /**
+     * p.distance(q, bound) if Point defines it, else p.distance(q).
+     */
+    template<class P>
+    static auto bounded_distance(const P& p, const P& q, double bound, int)
+        -> decltype(p.distance(q, bound)) { return p.distance(q, bound); }
+    template<class P>
+    static double bounded_distance(const P& p, const P& q, double, long)
+        { return p.distance(q); }
+    static double distance(const Point& p, const Point& q, double bound)
+        { return bounded_distance(p, q, bound, 0); }
+
     /**
      * Recursive implementation of the insert algorithm (see paper).
      */
@@ -176,7 +221,8 @@ class CoverTree
      */
 
     CoverTree(const double& maxDist,
-              const std::vector<Point>& points=std::vector<Point>());
+              const std::vector<Point>& points=std::vector<Point>(),
+              unsigned nthreads=1);
     ~CoverTree();
 
     /**
@@ -197,6 +243,22 @@ class CoverTree
      */
     void insert(const Point& newPoint);
 
+    /**
+     * Insert all of the points, with the same result as inserting them
+     * one at a time, except that the shape of the tree may differ.
+     *
+     * Rather than descending the tree once per point, this builds the
+     * new cover sets one level at a time, for all points at once: each
+     * point keeps the nodes of the current cover set that are near it,
+     * and from these finds its nodes in the next. That part runs on
+     * nthreads threads (zero means one per core); choosing which points
+     * become new nodes at each level is sequential, so the result does
+     * not depend on the number of threads.
+     *
+     * Points farther than maxDist from the root are ignored.
+     */
+    void batch_insert(const std::vector<Point>& points, unsigned nthreads=0);
+
     /**
      * Remove point p from the cover tree. If p is not present in the tree,
      * it will remain unchanged. Otherwise, this will remove exactly one
@@ -211,6 +273,18 @@ class CoverTree
      */
     std::vector<Point> k_nearest_neighbors(const Point& p, const unsigned int& k) const;
 
+    /**
+     * k_nearest_neighbors() for each of the queries, on nthreads threads
+     * (zero means one per core). Each thread takes a run of consecutive
+     * queries, and starts each search from the result of the one before,
+     * so that queries close to their predecessor are pruned early.
+     * Sorting the queries so that neighbours are adjacent helps.
+     */
+    std::vector<std::vector<Point> >
+        batch_k_nearest_neighbors(const std::vector<Point>& queries,
+                                  const unsigned int& k,
+                                  unsigned nthreads=0) const;
+
     CoverTreeNode* get_root() const;
 
     /**
@@ -221,16 +295,14 @@ class CoverTree
 
 template<class Point>
 CoverTree<Point>::CoverTree(const double& maxDist,
-                            const std::vector<Point>& points) : base(2.0)
+                            const std::vector<Point>& points,
+                            unsigned nthreads) : base(2.0)
 {
     _root=NULL;
     _numNodes=0;
     _maxLevel=ceilf(log(maxDist)/log(base));
     _minLevel=_maxLevel-1;
-    typename std::vector<Point>::const_iterator it;
-    for(it=points.begin(); it!=points.end(); ++it) {
-        this->insert(*it);
-    }
+    batch_insert(points, nthreads);
 }
 
 template<class Point>
@@ -254,17 +326,24 @@ CoverTree<Point>::~CoverTree()
 
 template<class Point>
 std::vector<typename CoverTree<Point>::CoverTreeNode*>
-CoverTree<Point>::k_nearest_nodes(const Point& p, const unsigned int& k) const
+CoverTree<Point>::k_nearest_nodes(const Point& p, const unsigned int& k,
+                                  const std::vector<CoverTreeNode*>& seed) const
 {
     if(_root==NULL) return std::vector<CoverTreeNode*>();
     //maxDist is the kth nearest known point to p, and also the farthest
     //point from p in the set minNodes defined below.
-    double maxDist = p.distance(_root->get_point());
+    double rootDist = p.distance(_root->get_point());
     //minNodes stores the k nearest known points to p.
     std::set<distNodePair> minNodes;
 
-    minNodes.insert(std::make_pair(maxDist,_root));
-    std::vector<distNodePair> Qj(1,std::make_pair(maxDist,_root));
+    minNodes.insert(std::make_pair(rootDist,_root));
+    typename std::vector<CoverTreeNode*>::const_iterator sit;
+    for(sit=seed.begin(); sit!=seed.end(); ++sit) {
+        minNodes.insert(std::make_pair(p.distance((*sit)->get_point()),*sit));
+        if(minNodes.size() > k) minNodes.erase(--minNodes.end());
+    }
+    double maxDist = (--minNodes.end())->first;
+    std::vector<distNodePair> Qj(1,std::make_pair(rootDist,_root));
     for(int level = _maxLevel; level>=_minLevel;level--) {
         typename std::vector<distNodePair>::const_iterator it;
         int size = Qj.size();
@@ -273,7 +352,11 @@ CoverTree<Point>::k_nearest_nodes(const Point& p, const unsigned int& k) const
                 Qj[i].second->get_children(level);
             typename std::vector<CoverTreeNode*>::const_iterator it2;
             for(it2=children.begin(); it2!=children.end(); ++it2) {
-                double d = p.distance((*it2)->get_point());
+                //Children farther than this are pruned below anyway.
+                double bound = minNodes.size() < k ?
+                    DBL_MAX : maxDist + pow(base, level);
+                double d = distance(p, (*it2)->get_point(), bound);
+                if(d > bound) continue;
                 if(d < maxDist || minNodes.size() < k) {
                     minNodes.insert(std::make_pair(d,*it2));
                     //--minNodes.end() gives us an iterator to the greatest
@@ -319,7 +402,7 @@ bool CoverTree<Point>::insert_rec(const Point& p,
         std::vector<CoverTreeNode*> children = it->second->get_children(level);
         typename std::vector<CoverTreeNode*>::const_iterator it2;
         for(it2=children.begin();it2!=children.end();++it2) {
-            double d = p.distance((*it2)->get_point());
+            double d = distance(p, (*it2)->get_point(), sep);
             if(d<minDist) minDist = d;
             if(d<=sep) {
                 Qj.push_back(std::make_pair(d,*it2));
@@ -493,6 +576,195 @@ void CoverTree<Point>::insert(const Point& newPoint)
     }
 }
 
+template<class Point>
+void CoverTree<Point>::batch_insert(const std::vector<Point>& points,
+                                    unsigned nthreads)
+{
+    if(points.empty()) return;
+    size_t first = 0;
+    if(_root==NULL) {
+        _root = new CoverTreeNode(points[0]);
+        _numNodes=1;
+        first = 1;
+    }
+
+    //A point not yet in the tree. near holds the nodes of the current
+    //cover set within radius(level) of it: that is far enough that the
+    //near nodes of the next cover set are all among their children.
+    //up holds the same for the cover set above.
+    struct Pending {
+        const Point* point;
+        std::vector<distNodePair> near;
+        std::vector<distNodePair> up;
+        CoverTreeNode* parent;
+        CoverTreeNode* twin;
+        bool separated;
+        bool placed;
+    };
+    const double ratio = base / (base - 1.0);
+
+    //As in insert(), points at distance zero from a node already in
+    //the tree join that node.
+    std::vector<CoverTreeNode*> twins(points.size(), NULL);
+    if(_numNodes > 1)
+        opencog::parallel_for(points.size() - first, nthreads,
+            [&](unsigned, size_t b, size_t e) {
+            for(size_t i=first+b; i<first+e; i++) {
+                std::vector<CoverTreeNode*> n = k_nearest_nodes(points[i], 1);
+                if(points[i].distance(n[0]->get_point()) == 0.0)
+                    twins[i] = n[0];
+            }
+        });
+
+    std::vector<Pending> pending;
+    std::vector<const Point*> deferred;
+    double top = pow(base, _maxLevel);
+    for(size_t i=first; i<points.size(); i++) {
+        if(twins[i] != NULL) { twins[i]->add_point(points[i]); continue; }
+        double d = points[i].distance(_root->get_point());
+        if(d > top) continue;
+        if(d == 0.0) { _root->add_point(points[i]); continue; }
+        Pending q = {&points[i], std::vector<distNodePair>(1,
+                     std::make_pair(d,_root)), {}, NULL, NULL, false, false};
+        pending.push_back(q);
+    }
+
+    //The new nodes of the cover set for level-1 are chosen greedily.
+    //As in insert_rec(), a point joins it only if it is farther than
+    //base^(level-1) from all of the cover set below, as well; this
+    //keeps the nodes added later, further down, apart from it. With
+    //base 2, those are children of near nodes.
+    for(int level=_maxLevel;
+        !pending.empty() && level > DBL_MIN_EXP - DBL_MANT_DIG; level--) {
+        double cover = pow(base, level);
+        double sep = pow(base, level-1);
+        double reach = sep * ratio;
+
+        //The nodes already in the next cover set, near each point;
+        //and the nearest node that covers it, which would be its
+        //parent.
+        opencog::parallel_for(pending.size(), nthreads,
+            [&](unsigned, size_t b, size_t e) {
+            for(size_t i=b; i<e; i++) {
+                Pending& q = pending[i];
+                q.up.swap(q.near);
+                q.near.clear();
+                q.parent = NULL;
+                double pd = DBL_MAX;
+                typename std::vector<distNodePair>::const_iterator it;
+                for(it=q.up.begin(); it!=q.up.end(); ++it) {
+                    if(it->first <= cover && it->first < pd) {
+                        pd = it->first;
+                        q.parent = it->second;
+                    }
+                    if(it->first <= reach) q.near.push_back(*it);
+                    std::vector<CoverTreeNode*> children =
+                        it->second->get_children(level);
+                    typename std::vector<CoverTreeNode*>::const_iterator it2;
+                    for(it2=children.begin(); it2!=children.end(); ++it2) {
+                        double d = distance(*q.point, (*it2)->get_point(), reach);
+                        if(d <= reach) q.near.push_back(std::make_pair(d,*it2));
+                    }
+                }
+
+                q.separated = true;
+                for(it=q.near.begin(); q.separated && it!=q.near.end(); ++it) {
+                    if(it->first <= sep) q.separated = false;
+                    if(it->first > 2.0*sep) continue;
+                    std::vector<CoverTreeNode*> below =
+                        it->second->get_children(level-1);
+                    typename std::vector<CoverTreeNode*>::const_iterator it2;
+                    for(it2=below.begin(); it2!=below.end(); ++it2)
+                        if(distance(*q.point, (*it2)->get_point(), sep) <= sep) {
+                            q.separated = false;
+                            break;
+                        }
+                }
+            }
+        });
+
+        //Choose the new nodes. A new node near a point has its parent
+        //among the point's up nodes.
+        std::unordered_map<CoverTreeNode*, std::vector<CoverTreeNode*> > fresh;
+        for(size_t i=0; i<pending.size(); i++) {
+            Pending& q = pending[i];
+            if(!q.separated) continue;
+            //insert_rec() would place this one higher up, where it
+            //has a parent; that level is done with, so leave it for
+            //insert().
+            if(q.parent == NULL) {
+                deferred.push_back(q.point);
+                q.placed = true;
+                continue;
+            }
+            bool isFree = true;
+            typename std::vector<distNodePair>::const_iterator it;
+            for(it=q.up.begin(); isFree && it!=q.up.end(); ++it) {
+                typename std::unordered_map<CoverTreeNode*,
+                    std::vector<CoverTreeNode*> >::const_iterator f =
+                    fresh.find(it->second);
+                if(f == fresh.end()) continue;
+                typename std::vector<CoverTreeNode*>::const_iterator it2;
+                for(it2=f->second.begin(); it2!=f->second.end(); ++it2)
+                    if(distance(*q.point, (*it2)->get_point(), sep) <= sep) {
+                        isFree = false;
+                        break;
+                    }
+            }
+            if(!isFree) continue;
+
+            CoverTreeNode* n = new CoverTreeNode(*q.point);
+            q.parent->add_child(level, n);
+            fresh[q.parent].push_back(n);
+            if(level-1<_minLevel) _minLevel=level-1;
+            _numNodes++;
+            q.placed = true;
+        }
+
+        //Add the new nodes to the near sets of the points left, and
+        //find those at distance zero from some node.
+        opencog::parallel_for(pending.size(), nthreads,
+            [&](unsigned, size_t b, size_t e) {
+            for(size_t i=b; i<e; i++) {
+                Pending& q = pending[i];
+                q.twin = NULL;
+                if(q.placed) continue;
+                typename std::vector<distNodePair>::const_iterator it;
+                for(it=q.up.begin(); it!=q.up.end(); ++it) {
+                    typename std::unordered_map<CoverTreeNode*,
+                        std::vector<CoverTreeNode*> >::const_iterator f =
+                        fresh.find(it->second);
+                    if(f == fresh.end()) continue;
+                    typename std::vector<CoverTreeNode*>::const_iterator it2;
+                    for(it2=f->second.begin(); it2!=f->second.end(); ++it2) {
+                        double d = distance(*q.point, (*it2)->get_point(), reach);
+                        if(d <= reach) q.near.push_back(std::make_pair(d,*it2));
+                    }
+                }
+                for(it=q.near.begin(); it!=q.near.end(); ++it)
+                    if(it->first == 0.0) q.twin = it->second;
+            }
+        });
+
+        size_t kept = 0;
+        for(size_t i=0; i<pending.size(); i++) {
+            Pending& q = pending[i];
+            if(q.placed) continue;
+            if(q.twin != NULL) {
+                q.twin->add_point(*q.point);
+                continue;
+            }
+            if(kept != i) pending[kept] = std::move(q);
+            kept++;
+        }
+        pending.resize(kept);
+    }
+
+    typename std::vector<const Point*>::const_iterator it;
+    for(it=deferred.begin(); it!=deferred.end(); ++it)
+        insert(**it);
+}
+
 template<class Point>
 void CoverTree<Point>::remove(const Point& p)
 {
@@ -539,10 +811,36 @@ std::vector<Point> CoverTree<Point>::k_nearest_neighbors(const Point& p,
                                                          const unsigned int& k) const
 {
     if(_root==NULL) return std::vector<Point>();
-    std::vector<CoverTreeNode*> v = k_nearest_nodes(p, k);
+    return collect_points(k_nearest_nodes(p, k), k);
+}
+
+template<class Point>
+std::vector<std::vector<Point> >
+CoverTree<Point>::batch_k_nearest_neighbors(const std::vector<Point>& queries,
+                                            const unsigned int& k,
+                                            unsigned nthreads) const
+{
+    std::vector<std::vector<Point> > kNN(queries.size());
+    if(_root==NULL) return kNN;
+    opencog::parallel_for(queries.size(), nthreads,
+        [&](unsigned, size_t b, size_t e) {
+        std::vector<CoverTreeNode*> nodes;
+        for(size_t i=b; i<e; i++) {
+            nodes = k_nearest_nodes(queries[i], k, nodes);
+            kNN[i] = collect_points(nodes, k);
+        }
+    });
+    return kNN;
+}
+
+template<class Point>
+std::vector<Point>
+CoverTree<Point>::collect_points(const std::vector<CoverTreeNode*>& nodes,
+                                 const unsigned int& k)
+{
     std::vector<Point> kNN;
     typename std::vector<CoverTreeNode*>::const_iterator it;
-    for(it=v.begin();it!=v.end();++it) {
+    for(it=nodes.begin();it!=nodes.end();++it) {
         const std::vector<Point>& p = (*it)->get_points();
         kNN.insert(kNN.end(),p.begin(),p.end());
         if(kNN.size() >= k) break;
@@ -0,0 +1,324 @@
+/*
+ * opencog/util/column_cluster.cc
+ *
+ * Copyright (C) 2026 OpenCog Foundation
+ * All Rights Reserved
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License v3 as
+ * published by the Free Software Foundation and including the exceptions
+ * at http://opencog.org/wiki/Licenses
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program; if not, write to:
+ * Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <cfloat>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+
+#include "column_cluster.h"
+#include "exceptions.h"
+#include "parallel_for.h"
+
+extern "C" {
+#include "cluster.h"
+}
+
+namespace opencog {
+
+// Items are handled in blocks of this many, so that the inner loops
+// run down a stretch of one column at a time.
+static const size_t BLOCK = 256;
+
+// No more threads than blocks.
+static unsigned thread_count(unsigned nthreads, size_t nblocks)
+{
+    return std::max<size_t>(1, std::min<size_t>(thread_count(nthreads), nblocks));
+}
+
+/* ================================================================ */
+
+namespace {
+
+// The working memory for one k-means run, allocated once.
+struct KMeans
+{
+    const feature_columns& cols;
+    size_t n, d, k;
+    unsigned nthreads;
+
+    std::vector<double> centroid;   // centroid[f*k + c]
+    std::vector<double> sums;       // same layout
+    std::vector<size_t> counts;
+    std::vector<int> id;
+    std::vector<double> mind;       // squared distance to own centroid
+    std::vector<double> scratch;    // k*BLOCK per thread
+    std::vector<size_t> changes;    // per thread
+
+    KMeans(const feature_columns& c, size_t nitems, size_t nclusters,
+           unsigned nth)
+        : cols(c), n(nitems), d(c.size()), k(nclusters), nthreads(nth),
+          centroid(d * k), sums(d * k), counts(k), id(n), mind(n),
+          scratch(nth * k * BLOCK), changes(nth)
+    {}
+
+    void seed(std::mt19937&);
+    size_t assign();
+    void update();
+    double error() const;
+};
+
+// k-means++: each next centroid is an item chosen with probability
+// proportional to its squared distance from the nearest centroid so
+// far.
+void KMeans::seed(std::mt19937& rng)
+{
+    std::uniform_int_distribution<size_t> pick(0, n - 1);
+    size_t first = pick(rng);
+    for (size_t f = 0; f < d; f++)
+        centroid[f*k] = cols[f][first];
+    std::fill(mind.begin(), mind.end(), DBL_MAX);
+
+    for (size_t c = 1; c <= k; c++)
+    {
+        // Bring the distances up to date with centroid c-1.
+        parallel_for(n, nthreads, [&](unsigned, size_t b, size_t e)
+        {
+            for (size_t i = b; i < e; i++)
+            {
+                double s = 0.0;
+                for (size_t f = 0; f < d; f++)
+                {
+                    double x = cols[f][i] - centroid[f*k + c - 1];
+                    s += x * x;
+                }
+                if (s < mind[i]) mind[i] = s;
+            }
+        }, BLOCK);
+        if (c == k) break;
+
+        double total = 0.0;
+        for (size_t i = 0; i < n; i++) total += mind[i];
+
+        size_t chosen = pick(rng);
+        if (0.0 < total)
+        {
+            double r = std::uniform_real_distribution<double>(0.0, total)(rng);
+            for (chosen = 0; chosen < n - 1; chosen++)
+            {
+                r -= mind[chosen];
+                if (r < 0.0) break;
+            }
+        }
+        for (size_t f = 0; f < d; f++)
+            centroid[f*k + c] = cols[f][chosen];
+    }
+}
+
+// Move each item to its nearest centroid. Returns the number of items
+// that moved.
+size_t KMeans::assign()
+{
+    // Threads with no items to look at leave their count alone.
+    std::fill(changes.begin(), changes.end(), 0);
+    parallel_for(n, nthreads, [&](unsigned tid, size_t b, size_t e)
+    {
+        double* dist = &scratch[tid * k * BLOCK];
+        size_t moved = 0;
+        for (size_t bb = b; bb < e; bb += BLOCK)
+        {
+            size_t len = std::min(BLOCK, e - bb);
+            std::fill(dist, dist + k * BLOCK, 0.0);
+            for (size_t f = 0; f < d; f++)
+            {
+                const double* x = cols[f] + bb;
+                const double* cf = &centroid[f*k];
+                for (size_t c = 0; c < k; c++)
+                {
+                    double* dc = dist + c * BLOCK;
+                    double y = cf[c];
+                    for (size_t i = 0; i < len; i++)
+                    {
+                        double t = x[i] - y;
+                        dc[i] += t * t;
+                    }
+                }
+            }
+            for (size_t i = 0; i < len; i++)
+            {
+                int best = 0;
+                double bd = dist[i];
+                for (size_t c = 1; c < k; c++)
+                    if (dist[c * BLOCK + i] < bd)
+                    {
+                        bd = dist[c * BLOCK + i];
+                        best = c;
+                    }
+                if (id[bb + i] != best) moved++;
+                id[bb + i] = best;
+                mind[bb + i] = bd;
+            }
+        }
+        changes[tid] = moved;
+    }, BLOCK);
+
+    size_t moved = 0;
+    for (unsigned t = 0; t < nthreads; t++) moved += changes[t];
+    return moved;
+}
+
+// Recompute the centroids. The threads split the features, rather than
+// the items; each one runs down whole columns, and the sums come out
+// the same for any number of threads.
+void KMeans::update()
+{
+    std::fill(counts.begin(), counts.end(), 0);
+    for (size_t i = 0; i < n; i++) counts[id[i]]++;
+
+    parallel_for(d, nthreads, [&](unsigned, size_t fb, size_t fe)
+    {
+        for (size_t f = fb; f < fe; f++)
+        {
+            double* s = &sums[f*k];
+            std::fill(s, s + k, 0.0);
+            const double* x = cols[f];
+            for (size_t i = 0; i < n; i++) s[id[i]] += x[i];
+            for (size_t c = 0; c < k; c++)
+                if (0 < counts[c]) centroid[f*k + c] = s[c] / counts[c];
+        }
+    });
+}
+
+double KMeans::error() const
+{
+    double err = 0.0;
+    for (size_t i = 0; i < n; i++) err += mind[i];
+    return err;
+}
+
+} // namespace
+
+std::vector<int> kmeans_cluster(const feature_columns& cols, size_t nitems,
+                                unsigned k, unsigned npass,
+                                unsigned nthreads, unsigned seed,
+                                double* error)
+{
+    if (0 == k)
+        throw InvalidParamException(TRACE_INFO,
+            "kmeans_cluster: need at least one cluster");
+    if (0 == nitems) return std::vector<int>();
+    k = std::min<size_t>(k, nitems);
+
+    nthreads = thread_count(nthreads, (nitems + BLOCK - 1) / BLOCK);
+    KMeans km(cols, nitems, k, nthreads);
+    std::vector<int> best;
+    double best_err = DBL_MAX;
+
+    // No column, no distances: everything is in one place.
+    if (cols.empty()) npass = 0;
+
+    std::mt19937 rng(seed);
+    for (unsigned pass = 0; pass < npass; pass++)
+    {
+        km.seed(rng);
+        std::fill(km.id.begin(), km.id.end(), -1);
+        for (int iter = 0; iter < 1000; iter++)
+        {
+            if (0 == km.assign()) break;
+            km.update();
+        }
+
+        double err = km.error();
+        if (err < best_err)
+        {
+            best_err = err;
+            best = km.id;
+        }
+    }
+
+    if (best.empty())
+    {
+        best.assign(nitems, 0);
+        best_err = 0.0;
+    }
+    if (error) *error = best_err;
+    return best;
+}
+
+/* ================================================================ */
+
+std::vector<double> distance_matrix(const feature_columns& cols,
+                                    size_t nitems, unsigned nthreads)
+{
+    std::vector<double> dm(nitems * (nitems - (0 < nitems)) / 2, 0.0);
+
+    // Row i has i entries. Take the blocks of rows in the order first,
+    // last, second, second-to-last, and so on, so that each thread's
+    // run of blocks has about as many long rows as short ones.
+    size_t nblocks = (nitems + BLOCK - 1) / BLOCK;
+    parallel_for(nblocks, nthreads, [&](unsigned, size_t b, size_t e)
+    {
+        for (size_t ob = b; ob < e; ob++)
+        {
+            size_t blk = (ob % 2) ? nblocks - 1 - ob / 2 : ob / 2;
+            size_t end = std::min(nitems, (blk + 1) * BLOCK);
+            for (size_t i = std::max<size_t>(1, blk * BLOCK); i < end; i++)
+            {
+                double* row = &dm[i * (i - 1) / 2];
+                for (const double* col : cols)
+                {
+                    double x = col[i];
+                    for (size_t j = 0; j < i; j++)
+                    {
+                        double t = x - col[j];
+                        row[j] += t * t;
+                    }
+                }
+                for (size_t j = 0; j < i; j++) row[j] = std::sqrt(row[j]);
+            }
+        }
+    });
+    return dm;
+}
+
+std::vector<int> tree_cluster(const feature_columns& cols, size_t nitems,
+                              unsigned k, char method, unsigned nthreads)
+{
+    if (0 == k)
+        throw InvalidParamException(TRACE_INFO,
+            "tree_cluster: need at least one cluster");
+    if ('s' != method and 'm' != method and 'a' != method)
+        throw InvalidParamException(TRACE_INFO,
+            "tree_cluster: unknown method '%c'", method);
+
+    std::vector<int> id(nitems, 0);
+    if (nitems < 2) return id;
+    k = std::min<size_t>(k, nitems);
+
+    // The layout treecluster() wants: row i points at its i entries.
+    std::vector<double> dm(distance_matrix(cols, nitems, nthreads));
+    std::vector<double*> rows(nitems, nullptr);
+    for (size_t i = 1; i < nitems; i++)
+        rows[i] = &dm[i * (i - 1) / 2];
+
+    Node* tree = treecluster(nitems, cols.size(), nullptr, nullptr, nullptr,
+                             0, 'e', method, rows.data());
+    if (nullptr == tree)
+        throw RuntimeException(TRACE_INFO,
+            "tree_cluster: out of memory");
+
+    cuttree(nitems, tree, k, id.data());
+    free(tree);
+    return id;
+}
+
+} // ~namespace opencog
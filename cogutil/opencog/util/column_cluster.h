@@ -0,0 +1,86 @@
+/*
+ * opencog/util/column_cluster.h
+ *
+ * Copyright (C) 2026 OpenCog Foundation
+ * All Rights Reserved
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License v3 as
+ * published by the Free Software Foundation and including the exceptions
+ * at http://opencog.org/wiki/Licenses
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program; if not, write to:
+ * Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#ifndef _OPENCOG_COLUMN_CLUSTER_H
+#define _OPENCOG_COLUMN_CLUSTER_H
+
+#include <cstddef>
+#include <vector>
+
+namespace opencog {
+
+/** \addtogroup grp_cogutil
+ *  @{
+ */
+
+/** @name Clustering over columns
+ *
+ * Clustering for tables stored one feature per column, the way the
+ * AtomSpace produces them: cols[f][i] is feature f of item i. The
+ * columns are read where they are; nothing is copied into rows. The
+ * distances are Euclidean.
+ *
+ * The work is split across nthreads threads; zero means one per
+ * core. The results do not depend on the number of threads, except
+ * for rounding in the k-means error.
+ */
+///@{
+
+typedef std::vector<const double*> feature_columns;
+
+/**
+ * k-means clustering, by Lloyd's algorithm, starting from a k-means++
+ * seeding. The whole run is repeated npass times, with different
+ * seeds, and the best is kept. Returns the cluster id, in [0, k), of
+ * each of the nitems items. If error is not null, it is set to the
+ * sum of the squared distances of the items to their centroids.
+ *
+ * All memory is allocated up front; the iterations allocate nothing.
+ */
+std::vector<int> kmeans_cluster(const feature_columns& cols, size_t nitems,
+                                unsigned k, unsigned npass = 1,
+                                unsigned nthreads = 0, unsigned seed = 0,
+                                double* error = nullptr);
+
+/**
+ * The pairwise distances of the items, as a lower triangle in one
+ * array: the distance from i to j < i is at i*(i-1)/2 + j.
+ */
+std::vector<double> distance_matrix(const feature_columns& cols,
+                                    size_t nitems, unsigned nthreads = 0);
+
+/**
+ * Hierarchical clustering by the C Clustering Library's treecluster(),
+ * cut into k clusters. The method is 's' (single linkage), 'm'
+ * (complete linkage) or 'a' (average linkage). The distance matrix,
+ * which is most of the work, is computed as above.
+ */
+std::vector<int> tree_cluster(const feature_columns& cols, size_t nitems,
+                              unsigned k, char method = 'a',
+                              unsigned nthreads = 0);
+
+///@}
+/** @}*/
+
+} // ~namespace opencog
+
+#endif // _OPENCOG_COLUMN_CLUSTER_H
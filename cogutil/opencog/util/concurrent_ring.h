@@ -0,0 +1,594 @@
+/*
+ * opencog/util/concurrent_ring.h
+ *
+ * Copyright (C) 2026 OpenCog Foundation
+ * All Rights Reserved
+ *
+ * The ring is the bounded multi-producer, multi-consumer queue of
+ * Dmitry Vyukov, extended with batch operations and blocking waits.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License v3 as
+ * published by the Free Software Foundation and including the exceptions
+ * at http://opencog.org/wiki/Licenses
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program; if not, write to:
+ * Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#ifndef _OC_CONCURRENT_RING_H
+#define _OC_CONCURRENT_RING_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+/** \addtogroup grp_cogutil
+ *  @{
+ */
+
+/// Wait strategies for concurrent_ring. A thread that has to wait for
+/// the ring (a consumer finding it empty, or a producer finding it
+/// full) first spins, re-trying, for `spins` rounds, and then parks on
+/// a condition variable. Spinning avoids the cost of a sleep and wake
+/// when the other side is only moments behind; parking avoids burning
+/// a CPU when it is not.
+struct spin_park_wait { static constexpr unsigned spins = 1024; };
+struct park_wait { static constexpr unsigned spins = 0; };
+
+//! A thread-safe, first in-first out ring buffer of fixed capacity.
+///
+/// This has the same API as concurrent_queue (also in this directory),
+/// so that the two can be swapped at any given use site; it adds
+/// try_push() and batch push and pop. The difference is in the cost:
+/// concurrent_queue takes a mutex on every push and pop, so many
+/// producers feeding one consumer will spend their time waiting on
+/// each other. Pushing onto and popping off of the ring takes no lock;
+/// each operation is a compare-and-swap on a shared position, followed
+/// by an uncontended store into a slot. A batch of N items costs one
+/// compare-and-swap, not N.
+///
+/// The ring is bounded: when it is full, push() waits until a consumer
+/// makes room. For producer-consumer uses where the producer might get
+/// far ahead -- or might fill the queue before anyone starts reading --
+/// the ring can be constructed to spill: items that do not fit are
+/// placed on an unbounded overflow list, under a mutex, and the ring
+/// never blocks a producer. Order is preserved either way.
+///
+/// Waits are governed by the `Wait` strategy; see spin_park_wait above.
+/// Producers and consumers only touch the mutex and condition variable
+/// when the other side is actually parked.
+template<typename Element, typename Wait = spin_park_wait>
+class concurrent_ring
+{
+private:
+    struct Cell
+    {
+        std::atomic<size_t> seq;
+        Element item;
+    };
+
+    std::unique_ptr<Cell[]> _ring;
+    size_t _mask;
+
+    // Producer and consumer positions live on separate cache lines.
+    alignas(64) std::atomic<size_t> _tail;
+    alignas(64) std::atomic<size_t> _head;
+
+    alignas(64) std::atomic<bool> _canceled;
+
+    // Parking lot, for threads that waited too long.
+    std::mutex _park_mtx;
+    std::condition_variable _not_empty;
+    std::condition_variable _not_full;
+    std::atomic<unsigned> _pop_waiters;
+    std::atomic<unsigned> _push_waiters;
+
+    // Overflow, for a spilling ring. Once anything has spilled, all
+    // pushes go to the overflow until the consumers have drained it;
+    // this keeps everything in order. It is allocated on the first
+    // spill, and is not null whenever `_spilled` is set.
+    const bool _spill;
+    std::atomic<bool> _spilled;
+    mutable std::mutex _overflow_mtx;
+    std::unique_ptr<std::deque<Element>> _overflow;
+
+    concurrent_ring(const concurrent_ring&) = delete;
+    concurrent_ring& operator=(const concurrent_ring&) = delete;
+
+    static void relax()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#else
+        std::this_thread::yield();
+#endif
+    }
+
+    /// Claim up to `want` consecutive free slots. Returns the position
+    /// of the first, and sets `got` to the number claimed.
+    size_t claim_push(size_t want, size_t& got)
+    {
+        size_t pos = _tail.load(std::memory_order_relaxed);
+        while (true)
+        {
+            // A slot is free when its sequence number equals its
+            // position. Count how many in a row are free.
+            size_t n = 0;
+            while (n < want)
+            {
+                Cell& c = _ring[(pos + n) & _mask];
+                size_t seq = c.seq.load(std::memory_order_acquire);
+                if (seq != pos + n) break;
+                n++;
+            }
+            if (0 == n)
+            {
+                // Either full, or some other producer got here first.
+                Cell& c = _ring[pos & _mask];
+                size_t seq = c.seq.load(std::memory_order_acquire);
+                if ((intptr_t) seq - (intptr_t) pos < 0) { got = 0; return pos; }
+                pos = _tail.load(std::memory_order_relaxed);
+                continue;
+            }
+
+            // If the CAS succeeds, then no other producer could have
+            // claimed any of these slots, and consumers never touch
+            // free slots. So all n of them are ours.
+            if (_tail.compare_exchange_weak(pos, pos + n,
+                                            std::memory_order_relaxed))
+            {
+                got = n;
+                return pos;
+            }
+        }
+    }
+
+    /// Claim up to `want` consecutive filled slots.
+    size_t claim_pop(size_t want, size_t& got)
+    {
+        size_t pos = _head.load(std::memory_order_relaxed);
+        while (true)
+        {
+            // A slot is filled when its sequence number is one
+            // past its position.
+            size_t n = 0;
+            while (n < want)
+            {
+                Cell& c = _ring[(pos + n) & _mask];
+                size_t seq = c.seq.load(std::memory_order_acquire);
+                if (seq != pos + n + 1) break;
+                n++;
+            }
+            if (0 == n)
+            {
+                Cell& c = _ring[pos & _mask];
+                size_t seq = c.seq.load(std::memory_order_acquire);
+                if ((intptr_t) seq - (intptr_t) (pos + 1) < 0) { got = 0; return pos; }
+                pos = _head.load(std::memory_order_relaxed);
+                continue;
+            }
+
+            if (_head.compare_exchange_weak(pos, pos + n,
+                                            std::memory_order_relaxed))
+            {
+                got = n;
+                return pos;
+            }
+        }
+    }
+
+    // Wake any parked consumers. The fence pairs with the one in
+    // wait_pop(), so that either the consumer sees the new item, or
+    // the producer sees the consumer waiting.
+    void wake_consumers()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (0 == _pop_waiters.load(std::memory_order_relaxed)) return;
+        std::lock_guard<std::mutex> lock(_park_mtx);
+        _not_empty.notify_all();
+    }
+
+    void wake_producers()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (0 == _push_waiters.load(std::memory_order_relaxed)) return;
+        std::lock_guard<std::mutex> lock(_park_mtx);
+        _not_full.notify_all();
+    }
+
+    template<typename It>
+    It ring_push(It first, It last)
+    {
+        while (first != last)
+        {
+            size_t got;
+            size_t pos = claim_push(std::distance(first, last), got);
+            if (0 == got) break;
+            for (size_t i = 0; i < got; i++, ++first)
+            {
+                Cell& c = _ring[(pos + i) & _mask];
+                c.item = *first;
+                c.seq.store(pos + i + 1, std::memory_order_release);
+            }
+        }
+        return first;
+    }
+
+    size_t ring_pop(std::vector<Element>& out, size_t max)
+    {
+        size_t got;
+        size_t pos = claim_pop(max, got);
+        for (size_t i = 0; i < got; i++)
+        {
+            Cell& c = _ring[(pos + i) & _mask];
+            out.emplace_back(std::move(c.item));
+            c.item = Element();
+            c.seq.store(pos + i + _mask + 1, std::memory_order_release);
+        }
+        return got;
+    }
+
+    bool ring_pop(Element& value)
+    {
+        size_t got;
+        size_t pos = claim_pop(1, got);
+        if (0 == got) return false;
+        Cell& c = _ring[pos & _mask];
+        value = std::move(c.item);
+        c.item = Element();
+        c.seq.store(pos + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Push onto a spilling ring; never blocks.
+    template<typename It>
+    void spill_push(It first, It last)
+    {
+        if (not _spilled.load(std::memory_order_acquire))
+        {
+            first = ring_push(first, last);
+            if (first == last) return;
+        }
+
+        std::lock_guard<std::mutex> lock(_overflow_mtx);
+        if (not _spilled.load(std::memory_order_relaxed))
+        {
+            first = ring_push(first, last);
+            if (first == last) return;
+            if (not _overflow)
+                _overflow.reset(new std::deque<Element>);
+            _spilled.store(true, std::memory_order_release);
+        }
+        for (; first != last; ++first)
+            _overflow->push_back(*first);
+    }
+
+    /// True if the ring is drained. Items that are claimed but not
+    /// yet stored count as being in the ring. The head is read first;
+    /// since it never passes the tail, equality means that the ring
+    /// was empty at the instant that the tail was read.
+    bool ring_drained() const
+    {
+        size_t head = _head.load(std::memory_order_acquire);
+        return _tail.load(std::memory_order_acquire) == head;
+    }
+
+    /// True if there may be overflow to take. This must be checked
+    /// again under the overflow lock: a producer claims its ring slots
+    /// before taking the lock to spill the rest, so anything it put on
+    /// the ring is visible by then, and must be popped first.
+    bool spill_ready() const
+    {
+        if (not _spill or not _spilled.load(std::memory_order_acquire))
+            return false;
+        return ring_drained();
+    }
+
+    /// Pop from the ring, and then from the overflow.
+    size_t do_pop(std::vector<Element>& out, size_t max)
+    {
+        size_t got = ring_pop(out, max);
+        if (0 < got or not spill_ready()) return got;
+
+        std::lock_guard<std::mutex> lock(_overflow_mtx);
+        if (not ring_drained()) return 0;
+        while (got < max and not _overflow->empty())
+        {
+            out.emplace_back(std::move(_overflow->front()));
+            _overflow->pop_front();
+            got++;
+        }
+        if (_overflow->empty())
+            _spilled.store(false, std::memory_order_release);
+        return got;
+    }
+
+    bool do_pop(Element& value)
+    {
+        if (ring_pop(value)) return true;
+        if (not spill_ready()) return false;
+
+        std::lock_guard<std::mutex> lock(_overflow_mtx);
+        if (not ring_drained()) return false;
+        if (_overflow->empty())
+        {
+            _spilled.store(false, std::memory_order_release);
+            // Anything pushed since went onto the ring.
+            return ring_pop(value);
+        }
+        value = std::move(_overflow->front());
+        _overflow->pop_front();
+        if (_overflow->empty())
+            _spilled.store(false, std::memory_order_release);
+        return true;
+    }
+
+    /// Spin, then park, until `attempt` succeeds or the ring is
+    /// canceled. Throws Canceled in the latter case.
+    template<typename Attempt>
+    void wait_for(Attempt attempt, std::condition_variable& cond,
+                  std::atomic<unsigned>& waiters)
+    {
+        for (unsigned i = 0; i < Wait::spins; i++)
+        {
+            if (_canceled.load(std::memory_order_relaxed)) throw Canceled();
+            if (attempt()) return;
+            relax();
+        }
+
+        std::unique_lock<std::mutex> lock(_park_mtx);
+        waiters.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        while (true)
+        {
+            if (_canceled.load(std::memory_order_relaxed))
+            {
+                waiters.fetch_sub(1, std::memory_order_relaxed);
+                throw Canceled();
+            }
+            if (attempt())
+            {
+                waiters.fetch_sub(1, std::memory_order_relaxed);
+                return;
+            }
+            cond.wait(lock);
+        }
+    }
+
+public:
+    /// The capacity is rounded up to a power of two. If `spill` is
+    /// true, the ring overflows onto an unbounded list instead of
+    /// blocking producers when full.
+    concurrent_ring(size_t capacity = 1024, bool spill = false)
+        : _tail(0), _head(0), _canceled(false),
+          _pop_waiters(0), _push_waiters(0),
+          _spill(spill), _spilled(false)
+    {
+        size_t cap = 2;
+        while (cap < capacity) cap <<= 1;
+        _ring.reset(new Cell[cap]);
+        _mask = cap - 1;
+        for (size_t i = 0; i < cap; i++)
+            _ring[i].seq.store(i, std::memory_order_relaxed);
+    }
+
+    ~concurrent_ring()
+    { if (not _canceled) cancel(); }
+
+    struct Canceled : public std::exception
+    {
+        const char * what() { return "Cancellation of wait on concurrent_ring"; }
+    };
+
+    size_t capacity() const noexcept { return _mask + 1; }
+
+    /// Try to push the Element. Returns false if the ring is full
+    /// (never, for a spilling ring).
+    bool try_push(const Element& item)
+    {
+        if (_canceled) throw Canceled();
+        const Element* p = &item;
+        if (_spill) spill_push(p, p+1);
+        else if (ring_push(p, p+1) == p) return false;
+        wake_consumers();
+        return true;
+    }
+    bool try_put(const Element& item) { return try_push(item); }
+
+    /// Push the Element, waiting for room if the ring is full.
+    void push(const Element& item)
+    {
+        if (try_push(item)) return;
+        const Element* p = &item;
+        wait_for([&]() { return ring_push(p, p+1) != p; },
+                 _not_full, _push_waiters);
+        wake_consumers();
+    }
+
+    void push(Element&& item)
+    {
+        if (_canceled) throw Canceled();
+        auto first = std::make_move_iterator(&item);
+        auto last = std::make_move_iterator(&item + 1);
+        if (_spill) spill_push(first, last);
+        else if (ring_push(first, last) == first)
+        {
+            wait_for([&]() { return ring_push(first, last) != first; },
+                     _not_full, _push_waiters);
+        }
+        wake_consumers();
+    }
+
+    /// Push as many of the Elements as will fit, all at once.
+    /// Returns an iterator to the first one not pushed.
+    template<typename It>
+    It try_push_batch(It first, It last)
+    {
+        if (_canceled) throw Canceled();
+        if (_spill) { spill_push(first, last); first = last; }
+        else first = ring_push(first, last);
+        wake_consumers();
+        return first;
+    }
+
+    /// Push all of the Elements, waiting for room as needed. Other
+    /// producers may interleave with the batch, if it does not fit
+    /// all at once.
+    template<typename It>
+    void push_batch(It first, It last)
+    {
+        first = try_push_batch(first, last);
+        while (first != last)
+        {
+            wait_for([&]() {
+                    It next = ring_push(first, last);
+                    bool progress = (next != first);
+                    first = next;
+                    return progress;
+                }, _not_full, _push_waiters);
+            wake_consumers();
+        }
+    }
+
+    /// Return true if the queue is empty at this instant in time.
+    bool is_empty() const
+    {
+        if (_canceled) throw Canceled();
+        return 0 == size();
+    }
+
+    /// Return true if a push would have to wait.
+    bool is_full() const noexcept
+    {
+        if (_spill) return false;
+        return capacity() <= size();
+    }
+
+    /// Return the size of the queue at this instant in time.
+    size_t size() const
+    {
+        size_t tail = _tail.load(std::memory_order_acquire);
+        size_t head = _head.load(std::memory_order_acquire);
+        size_t sz = (tail < head) ? 0 : tail - head;
+        if (_spill and _spilled.load(std::memory_order_acquire))
+        {
+            std::lock_guard<std::mutex> lock(_overflow_mtx);
+            if (_overflow) sz += _overflow->size();
+        }
+        return sz;
+    }
+
+    /// Try to get an element off the front of the queue. Return true
+    /// if success, else return false.
+    bool try_get(Element& value)
+    {
+        if (_canceled) throw Canceled();
+        if (not do_pop(value)) return false;
+        wake_producers();
+        return true;
+    }
+    bool try_pop(Element& value) { return try_get(value); }
+
+    /// Pop an item off the queue. Block if the queue is empty.
+    void pop(Element& value)
+    {
+        if (try_get(value)) return;
+        wait_for([&]() { return do_pop(value); },
+                 _not_empty, _pop_waiters);
+        wake_producers();
+    }
+    void wait_pop(Element& value) { pop(value); }
+
+    Element value_pop()
+    {
+        Element value;
+        pop(value);
+        return value;
+    }
+
+    /// Move up to `max` items onto the end of `out`, without waiting.
+    /// Returns the number moved.
+    size_t try_pop_batch(std::vector<Element>& out, size_t max = SIZE_MAX)
+    {
+        if (_canceled) throw Canceled();
+        size_t got = do_pop(out, max);
+        if (0 < got) wake_producers();
+        return got;
+    }
+
+    /// Move up to `max` items onto the end of `out`, waiting until
+    /// there is at least one.
+    size_t pop_batch(std::vector<Element>& out, size_t max = SIZE_MAX)
+    {
+        size_t got = try_pop_batch(out, max);
+        if (0 < got) return got;
+        wait_for([&]() { got = do_pop(out, max); return 0 < got; },
+                 _not_empty, _pop_waiters);
+        wake_producers();
+        return got;
+    }
+
+    /// Wait until the queue is non-empty, or is canceled, and then
+    /// take everything on it.
+    std::queue<Element> wait_and_take_all()
+    {
+        std::vector<Element> all;
+        try { if (not _canceled) barrier(); }
+        catch (const Canceled&) {}
+
+        while (0 < do_pop(all, SIZE_MAX)) {}
+        wake_producers();
+
+        std::queue<Element> retval;
+        for (Element& e : all) retval.push(std::move(e));
+        return retval;
+    }
+
+    /// A weak barrier. Block as long as the queue is empty.
+    void barrier()
+    {
+        wait_for([&]() { return 0 < size(); }, _not_empty, _pop_waiters);
+    }
+
+    void cancel_reset()
+    {
+        // This doesn't lose data, but it instead allows new calls
+        // to not throw Canceled exceptions
+        _canceled = false;
+    }
+    void open() { cancel_reset(); }
+
+    void cancel()
+    {
+        if (_canceled.exchange(true)) throw Canceled();
+        std::lock_guard<std::mutex> lock(_park_mtx);
+        _not_empty.notify_all();
+        _not_full.notify_all();
+    }
+    void close() { cancel(); }
+
+    bool is_closed() const noexcept { return _canceled; }
+
+    /// Lock-free until spill: push and pop on the ring itself take no
+    /// lock (short of waiting on a full or empty ring), but a spilling
+    /// ring takes a mutex for the overflow. So this is true only for a
+    /// ring that cannot spill.
+    bool is_lock_free() const noexcept { return not _spill; }
+};
+/** @}*/
+
+#endif // _OC_CONCURRENT_RING_H
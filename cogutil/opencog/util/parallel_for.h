@@ -0,0 +1,73 @@
+/*
+ * opencog/util/parallel_for.h
+ *
+ * Copyright (C) 2026 OpenCog Foundation
+ * All Rights Reserved
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License v3 as
+ * published by the Free Software Foundation and including the exceptions
+ * at http://opencog.org/wiki/Licenses
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program; if not, write to:
+ * Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#ifndef _OPENCOG_PARALLEL_FOR_H
+#define _OPENCOG_PARALLEL_FOR_H
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+/** \addtogroup grp_cogutil
+ *  @{
+ */
+
+namespace opencog {
+
+//! The number of threads to use: `nthreads`, or, if that is zero,
+//! one per core.
+inline unsigned thread_count(unsigned nthreads)
+{
+    if (0 == nthreads) nthreads = std::thread::hardware_concurrency();
+    return std::max(1u, nthreads);
+}
+
+//! Run fn(tid, begin, end) over [0, n), split across up to `nthreads`
+//! threads (zero means one per core), in contiguous runs of whole
+//! blocks of `block` items. Each thread gets at least one block, so
+//! that small jobs use fewer threads; a job of one block runs inline,
+//! on the calling thread. The thread ids run from zero, and are less
+//! than thread_count(nthreads). Threads whose run would be empty are
+//! not started.
+template<typename F>
+void parallel_for(size_t n, unsigned nthreads, F fn, size_t block = 1)
+{
+    size_t nblocks = (n + block - 1) / block;
+    size_t nchunks = std::min<size_t>(thread_count(nthreads), nblocks);
+    if (nchunks <= 1) { fn(0u, 0, n); return; }
+
+    size_t per = ((nblocks + nchunks - 1) / nchunks) * block;
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < nchunks; t++)
+    {
+        size_t b = t * per;
+        if (n <= b) break;
+        workers.emplace_back(fn, t, b, std::min(n, b + per));
+    }
+    for (std::thread& w : workers) w.join();
+}
+
+} // ~namespace opencog
+
+/** @}*/
+
+#endif // _OPENCOG_PARALLEL_FOR_H
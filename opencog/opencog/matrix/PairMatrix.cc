@@ -0,0 +1,347 @@
+/*
+ * PairMatrix.cc
+ *
+ * Copyright (C) 2026 OpenCog Foundation
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License v3 as
+ * published by the Free Software Foundation and including the exceptions
+ * at http://opencog.org/wiki/Licenses
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program; if not, write to:
+ * Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <tuple>
+
+#include <opencog/util/parallel_for.h>
+#include <opencog/atoms/base/Link.h>
+#include <opencog/atoms/value/FloatValue.h>
+#include <opencog/atomspace/AtomSpace.h>
+#include "PairMatrix.h"
+
+namespace opencog
+{
+
+/* Row ranges smaller than this are not worth starting a thread for;
+ * see parallel_for(). */
+static const size_t MIN_CHUNK = 256;
+
+/* ================================================================ */
+
+PairMatrix::PairMatrix(AtomSpace* as, Type pair_type, const Handle& relation,
+                       const Handle& count_key, size_t count_index)
+    : _as(as)
+{
+    HandleSeq pairs;
+    if (relation)
+        pairs = relation->getIncomingSetByType(pair_type, as);
+    else
+        as->get_handles_by_type(pairs, pair_type);
+    build(pairs, relation, count_key, count_index);
+}
+
+PairMatrix::PairMatrix(AtomSpace* as, const HandleSeq& pairs,
+                       const Handle& relation,
+                       const Handle& count_key, size_t count_index)
+    : _as(as)
+{
+    build(pairs, relation, count_key, count_index);
+}
+
+PairMatrix::Index PairMatrix::add(const Handle& h, HandleSeq& atoms,
+                                  std::unordered_map<Handle, Index>& index)
+{
+    auto it = index.find(h);
+    if (it != index.end()) return it->second;
+
+    Index i = atoms.size();
+    atoms.emplace_back(h);
+    index.emplace(h, i);
+    return i;
+}
+
+PairMatrix::Index PairMatrix::row(const Handle& h) const
+{
+    auto it = _row_index.find(h);
+    return it == _row_index.end() ? NO_INDEX : it->second;
+}
+
+PairMatrix::Index PairMatrix::col(const Handle& h) const
+{
+    auto it = _col_index.find(h);
+    return it == _col_index.end() ? NO_INDEX : it->second;
+}
+
+void PairMatrix::build(const HandleSeq& pairs, const Handle& relation,
+                       const Handle& count_key, size_t count_index)
+{
+    // Collect the counts, numbering the rows and columns as they are
+    // found.
+    std::vector<std::tuple<Index, Index, double, Handle>> entries;
+    for (const Handle& pair : pairs)
+    {
+        if (not pair->is_link() or 2 != pair->get_arity()) continue;
+
+        const Handle* lr = pair->getOutgoingSet().data();
+        if (relation)
+        {
+            if (*lr != relation) continue;
+            const Handle& list = lr[1];
+            if (not list->is_link() or 2 != list->get_arity()) continue;
+            lr = list->getOutgoingSet().data();
+        }
+
+        ValuePtr vp = pair->getValue(count_key);
+        if (nullptr == vp or not vp->is_type(FLOAT_VALUE)) continue;
+        const std::vector<double>& fv = FloatValueCast(vp)->value();
+        if (fv.size() <= count_index) continue;
+
+        // A zero count is no observation at all; keeping it would put
+        // log2(0) into the MI, and empty rows into the similarities.
+        if (0.0 == fv[count_index]) continue;
+
+        entries.emplace_back(add(lr[0], _rows, _row_index),
+                             add(lr[1], _cols, _col_index),
+                             fv[count_index], pair);
+    }
+
+    // Row-major, with the columns in order within each row. The
+    // pairs are kept in the same order.
+    std::sort(entries.begin(), entries.end(),
+        [](const auto& a, const auto& b) {
+            return std::tie(std::get<0>(a), std::get<1>(a))
+                 < std::tie(std::get<0>(b), std::get<1>(b)); });
+
+    size_t nnz = entries.size();
+    _csr.offsets.assign(_rows.size() + 1, 0);
+    _csr.index.resize(nnz);
+    _csr.value.resize(nnz);
+    _csr.pair.resize(nnz);
+    _pairs.resize(nnz);
+    for (size_t k = 0; k < nnz; k++)
+    {
+        _csr.offsets[std::get<0>(entries[k]) + 1]++;
+        _csr.index[k] = std::get<1>(entries[k]);
+        _csr.value[k] = std::get<2>(entries[k]);
+        _csr.pair[k] = k;
+        _pairs[k] = std::get<3>(entries[k]);
+    }
+    for (size_t r = 0; r < _rows.size(); r++)
+        _csr.offsets[r + 1] += _csr.offsets[r];
+
+    // Counting sort by column; the rows stay in order within each.
+    _csc.offsets.assign(_cols.size() + 1, 0);
+    for (Index c : _csr.index) _csc.offsets[c + 1]++;
+    for (size_t c = 0; c < _cols.size(); c++)
+        _csc.offsets[c + 1] += _csc.offsets[c];
+
+    _csc.index.resize(nnz);
+    _csc.value.resize(nnz);
+    _csc.pair.resize(nnz);
+    std::vector<size_t> pos(_csc.offsets.begin(), _csc.offsets.end() - 1);
+    for (Index r = 0; r < _rows.size(); r++)
+    {
+        for (size_t k = _csr.offsets[r]; k < _csr.offsets[r + 1]; k++)
+        {
+            size_t p = pos[_csr.index[k]]++;
+            _csc.index[p] = r;
+            _csc.value[p] = _csr.value[k];
+            _csc.pair[p] = k;
+        }
+    }
+}
+
+/* ================================================================ */
+
+/// Sum each line of a compressed matrix.
+static std::vector<double> line_sums(const PairMatrix::Compressed& m,
+                                     unsigned nthreads)
+{
+    size_t n = m.offsets.size() - 1;
+    std::vector<double> sums(n);
+    parallel_for(n, nthreads, [&](size_t, size_t b, size_t e)
+    {
+        for (size_t i = b; i < e; i++)
+        {
+            const double* v = m.value.data();
+            double s = 0.0;
+            for (size_t k = m.offsets[i]; k < m.offsets[i + 1]; k++)
+                s += v[k];
+            sums[i] = s;
+        }
+    }, MIN_CHUNK);
+    return sums;
+}
+
+std::vector<double> PairMatrix::row_sums(unsigned nthreads) const
+{
+    return line_sums(_csr, nthreads);
+}
+
+std::vector<double> PairMatrix::col_sums(unsigned nthreads) const
+{
+    return line_sums(_csc, nthreads);
+}
+
+double PairMatrix::total() const
+{
+    return std::accumulate(_csr.value.begin(), _csr.value.end(), 0.0);
+}
+
+std::vector<double> PairMatrix::mutual_information(unsigned nthreads) const
+{
+    std::vector<double> rsum(row_sums(nthreads));
+    std::vector<double> csum(col_sums(nthreads));
+    double log_total = std::log2(total());
+
+    std::vector<double> mi(_pairs.size());
+    parallel_for(_rows.size(), nthreads, [&](size_t, size_t b, size_t e)
+    {
+        for (size_t r = b; r < e; r++)
+        {
+            double lr = log_total - std::log2(rsum[r]);
+            for (size_t k = _csr.offsets[r]; k < _csr.offsets[r + 1]; k++)
+                mi[k] = std::log2(_csr.value[k])
+                    - std::log2(csum[_csr.index[k]]) + lr;
+        }
+    }, MIN_CHUNK);
+    return mi;
+}
+
+/* ================================================================ */
+
+/// The similarity of each row to all others, at once. For row i, walk
+/// its columns, and for each, the other rows having that column; this
+/// accumulates the dot product (or the sum of minima) of row i with
+/// every row that shares anything with it, touching no others. Each
+/// thread takes a contiguous block of rows, with its own accumulator.
+PairMatrix::Ranking PairMatrix::top_k(size_t k, Similarity sim,
+                                      unsigned nthreads) const
+{
+    size_t nr = _rows.size();
+
+    // Norms: Euclidean for cosine, L1 for Jaccard.
+    std::vector<double> norm(nr);
+    parallel_for(nr, nthreads, [&](size_t, size_t b, size_t e)
+    {
+        for (size_t r = b; r < e; r++)
+        {
+            double s = 0.0;
+            for (size_t p = _csr.offsets[r]; p < _csr.offsets[r + 1]; p++)
+            {
+                double v = _csr.value[p];
+                s += (COSINE == sim) ? v * v : v;
+            }
+            norm[r] = (COSINE == sim) ? std::sqrt(s) : s;
+        }
+    }, MIN_CHUNK);
+
+    Ranking ranking(nr);
+    parallel_for(nr, nthreads, [&](size_t, size_t b, size_t e)
+    {
+        std::vector<double> acc(nr, 0.0);
+        std::vector<bool> seen(nr, false);
+        std::vector<Index> touched;
+        std::vector<std::pair<Index, double>> scores;
+
+        for (size_t i = b; i < e; i++)
+        {
+            for (size_t p = _csr.offsets[i]; p < _csr.offsets[i + 1]; p++)
+            {
+                double a = _csr.value[p];
+                Index c = _csr.index[p];
+                size_t cb = _csc.offsets[c], ce = _csc.offsets[c + 1];
+                const Index* rows = _csc.index.data();
+                const double* vals = _csc.value.data();
+                for (size_t q = cb; q < ce; q++)
+                {
+                    Index j = rows[q];
+                    if (not seen[j]) { seen[j] = true; touched.push_back(j); }
+                    acc[j] += (COSINE == sim) ? a * vals[q]
+                                              : std::min(a, vals[q]);
+                }
+            }
+
+            scores.clear();
+            for (Index j : touched)
+            {
+                double dot = acc[j];
+                acc[j] = 0.0;
+                seen[j] = false;
+                if (j == i or 0.0 == dot) continue;
+                double s = (COSINE == sim) ?
+                    dot / (norm[i] * norm[j]) :
+                    dot / (norm[i] + norm[j] - dot);
+                scores.emplace_back(j, s);
+            }
+            touched.clear();
+
+            size_t n = std::min(k, scores.size());
+            std::partial_sort(scores.begin(), scores.begin() + n,
+                scores.end(), [](const auto& x, const auto& y) {
+                    return x.second > y.second or
+                        (x.second == y.second and x.first < y.first); });
+            ranking[i].assign(scores.begin(), scores.begin() + n);
+        }
+    }, MIN_CHUNK);
+    return ranking;
+}
+
+/* ================================================================ */
+
+void PairMatrix::set_marginals(const Handle& key, unsigned nthreads) const
+{
+    std::vector<double> rsum(row_sums(nthreads));
+    std::vector<double> csum(col_sums(nthreads));
+
+    // Most Atoms are both rows and columns (a word has a left and a
+    // right marginal), so the two go into one value.
+    for (size_t r = 0; r < _rows.size(); r++)
+    {
+        Index c = col(_rows[r]);
+        double cs = (NO_INDEX == c) ? 0.0 : csum[c];
+        _as->set_value(_rows[r], key, createFloatValue(
+            std::vector<double>({rsum[r], cs})));
+    }
+    for (size_t c = 0; c < _cols.size(); c++)
+    {
+        if (NO_INDEX != row(_cols[c])) continue;
+        _as->set_value(_cols[c], key, createFloatValue(
+            std::vector<double>({0.0, csum[c]})));
+    }
+}
+
+void PairMatrix::set_pair_values(const Handle& key,
+                                 const std::vector<double>& vals) const
+{
+    size_t n = std::min(vals.size(), _pairs.size());
+    for (size_t k = 0; k < n; k++)
+        _as->set_value(_pairs[k], key, createFloatValue(vals[k]));
+}
+
+void PairMatrix::set_similarities(const Handle& key, const Ranking& ranking,
+                                  Type link_type) const
+{
+    size_t n = std::min(ranking.size(), _rows.size());
+    for (size_t r = 0; r < n; r++)
+    {
+        for (const auto& pr : ranking[r])
+        {
+            Handle sim(_as->add_link(link_type, _rows[r], _rows[pr.first]));
+            _as->set_value(sim, key, createFloatValue(pr.second));
+        }
+    }
+}
+
+} // namespace opencog
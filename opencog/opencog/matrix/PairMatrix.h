@@ -0,0 +1,172 @@
+/*
+ * PairMatrix.h
+ *
+ * Copyright (C) 2026 OpenCog Foundation
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License v3 as
+ * published by the Free Software Foundation and including the exceptions
+ * at http://opencog.org/wiki/Licenses
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program; if not, write to:
+ * Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#ifndef _OPENCOG_PAIR_MATRIX_H
+#define _OPENCOG_PAIR_MATRIX_H
+
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <opencog/atoms/base/Handle.h>
+#include <opencog/atoms/atom_types/atom_types.h>
+
+namespace opencog
+{
+/** \addtogroup grp_atomspace
+ *  @{
+ */
+
+class AtomSpace;
+
+/**
+ * A frozen snapshot of the counts on a set of pairs, as a sparse
+ * matrix, for computing pair statistics over all of it at once.
+ *
+ * The learn pipeline keeps counts on pairs such as
+ *
+ *     EdgeLink
+ *         BondNode "ANY"
+ *         ListLink
+ *             WordNode "left"
+ *             WordNode "right"
+ *
+ * and computes marginals, mutual information and similarities in
+ * scheme, one cog-value call at a time. Here, the pairs are read once.
+ * Each distinct left Atom becomes a row, each right Atom a column, and
+ * the counts are stored both by row (CSR) and by column (CSC). After
+ * that, the statistics are loops over arrays of doubles, split across
+ * threads, and the results are written back as FloatValues.
+ *
+ * The pairs are the Links of a given type. If a `relation` is given,
+ * they have the form (PairType relation (ListLink left right)), as
+ * above, and are found through the incoming set of the relation;
+ * otherwise they have the form (PairType left right). The count is
+ * entry `count_index` of the FloatValue at `count_key` on each pair;
+ * pairs with no count, or a count of zero, are left out.
+ *
+ * The matrix is a snapshot: changes made to the AtomSpace after it
+ * was built are not seen.
+ */
+class PairMatrix
+{
+public:
+    typedef uint32_t Index;
+    static const Index NO_INDEX = UINT32_MAX;
+
+    /// A compressed sparse matrix. The entries of line i (a row in
+    /// the CSR, a column in the CSC) are at offsets[i] .. offsets[i+1];
+    /// `index` holds the column (or row) of each, `value` the count,
+    /// and `pair` the position of the pair Atom in pairs().
+    struct Compressed
+    {
+        std::vector<size_t> offsets;
+        std::vector<Index> index;
+        std::vector<double> value;
+        std::vector<size_t> pair;
+
+        size_t length(Index i) const
+            { return offsets[i+1] - offsets[i]; }
+    };
+
+    /// Up to k (index, score) results per row, best first.
+    typedef std::vector<std::vector<std::pair<Index, double>>> Ranking;
+
+    enum Similarity { COSINE, JACCARD };
+
+private:
+    AtomSpace* _as;
+    HandleSeq _rows;
+    HandleSeq _cols;
+    HandleSeq _pairs;
+    std::unordered_map<Handle, Index> _row_index;
+    std::unordered_map<Handle, Index> _col_index;
+
+    Compressed _csr;
+    Compressed _csc;
+
+    void build(const HandleSeq&, const Handle&, const Handle&, size_t);
+    Index add(const Handle&, HandleSeq&, std::unordered_map<Handle, Index>&);
+
+public:
+    /// Read all of the pairs of type `pair_type`.
+    PairMatrix(AtomSpace*, Type pair_type, const Handle& relation,
+               const Handle& count_key, size_t count_index = 0);
+
+    /// Read the given pairs. Results are written to the AtomSpace.
+    PairMatrix(AtomSpace*, const HandleSeq& pairs, const Handle& relation,
+               const Handle& count_key, size_t count_index = 0);
+
+    size_t num_rows() const { return _rows.size(); }
+    size_t num_cols() const { return _cols.size(); }
+    size_t num_pairs() const { return _pairs.size(); }
+
+    const Handle& row_atom(Index r) const { return _rows[r]; }
+    const Handle& col_atom(Index c) const { return _cols[c]; }
+    const HandleSeq& pairs() const { return _pairs; }
+    Index row(const Handle&) const;
+    Index col(const Handle&) const;
+
+    const Compressed& csr() const { return _csr; }
+    const Compressed& csc() const { return _csc; }
+
+    // The computations below run on `nthreads` threads; zero means
+    // one per CPU core.
+
+    /// The marginal counts N(x,*), one per row, and N(*,y), one per
+    /// column; and the grand total N(*,*).
+    std::vector<double> row_sums(unsigned nthreads = 0) const;
+    std::vector<double> col_sums(unsigned nthreads = 0) const;
+    double total() const;
+
+    /// The pointwise mutual information of each pair, in bits:
+    ///     log2 N(x,y) N(*,*) / N(x,*) N(*,y)
+    /// One per pair, in the order of pairs().
+    std::vector<double> mutual_information(unsigned nthreads = 0) const;
+
+    /// For each row, the k other rows most similar to it, by the
+    /// cosine of their count vectors, or by their weighted Jaccard
+    /// similarity, sum min(a,b) / sum max(a,b). Rows with nothing in
+    /// common are never listed.
+    Ranking top_k(size_t k, Similarity = COSINE,
+                  unsigned nthreads = 0) const;
+
+    /// Write the marginal counts to the row and column Atoms, as a
+    /// FloatValue at `key` holding N(x,*) and N(*,x), in that order.
+    /// An Atom that is only a row has zero for the second, and one
+    /// that is only a column has zero for the first.
+    void set_marginals(const Handle& key, unsigned nthreads = 0) const;
+
+    /// Write one number per pair to the pair Atoms, as a FloatValue
+    /// at `key`.
+    void set_pair_values(const Handle& key, const std::vector<double>&) const;
+
+    /// Write the similarities to links (link_type row other), which
+    /// are created as needed, as a FloatValue at `key`.
+    void set_similarities(const Handle& key, const Ranking&,
+                          Type link_type = SIMILARITY_LINK) const;
+};
+
+/** @}*/
+}
+
+#endif // _OPENCOG_PAIR_MATRIX_H
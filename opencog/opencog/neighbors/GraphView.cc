@@ -0,0 +1,321 @@
+/*
+ * GraphView.cc
+ *
+ * Copyright (C) 2026 OpenCog Foundation
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License v3 as
+ * published by the Free Software Foundation and including the exceptions
+ * at http://opencog.org/wiki/Licenses
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program; if not, write to:
+ * Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+#include <opencog/util/parallel_for.h>
+#include <opencog/atoms/base/Link.h>
+#include <opencog/atoms/value/FloatValue.h>
+#include <opencog/atomspace/AtomSpace.h>
+#include "GraphView.h"
+
+namespace opencog
+{
+
+/* Frontiers and vertex ranges smaller than this are not worth starting
+ * a thread for; see parallel_for(). */
+static const size_t MIN_CHUNK = 2048;
+
+/* ================================================================ */
+
+GraphView::GraphView(AtomSpace* as, Type link_type, bool subtypes,
+                     bool directed)
+    : _as(as)
+{
+    HandleSeq links;
+    as->get_handles_by_type(links, link_type, subtypes);
+    build(links, directed);
+}
+
+GraphView::GraphView(AtomSpace* as, const HandleSeq& links, bool directed)
+    : _as(as)
+{
+    build(links, directed);
+}
+
+GraphView::Vertex GraphView::add_vertex(const Handle& h)
+{
+    auto it = _index.find(h);
+    if (it != _index.end()) return it->second;
+
+    Vertex v = _atoms.size();
+    _atoms.emplace_back(h);
+    _index.emplace(h, v);
+    return v;
+}
+
+GraphView::Vertex GraphView::vertex(const Handle& h) const
+{
+    auto it = _index.find(h);
+    if (it == _index.end()) return NO_VERTEX;
+    return it->second;
+}
+
+void GraphView::build(const HandleSeq& links, bool directed)
+{
+    // Collect the edges, numbering the vertices as they are found.
+    std::vector<std::pair<Vertex, Vertex>> edges;
+    for (const Handle& link : links)
+    {
+        if (not link->is_link()) continue;
+        const HandleSeq& oset = link->getOutgoingSet();
+        if (oset.size() < 2) continue;
+
+        std::vector<Vertex> vs;
+        for (const Handle& h : oset) vs.push_back(add_vertex(h));
+
+        if (nameserver().isA(link->get_type(), UNORDERED_LINK))
+        {
+            for (size_t i = 0; i < vs.size(); i++)
+                for (size_t j = 0; j < vs.size(); j++)
+                    if (vs[i] != vs[j]) edges.emplace_back(vs[i], vs[j]);
+            continue;
+        }
+
+        for (size_t i = 1; i < vs.size(); i++)
+        {
+            if (vs[0] == vs[i]) continue;
+            edges.emplace_back(vs[0], vs[i]);
+            if (not directed) edges.emplace_back(vs[i], vs[0]);
+        }
+    }
+
+    // Counting sort, once by source, and once by target.
+    size_t nv = _atoms.size();
+    _out_off.assign(nv + 1, 0);
+    _in_off.assign(nv + 1, 0);
+    for (const auto& e : edges)
+    {
+        _out_off[e.first + 1]++;
+        _in_off[e.second + 1]++;
+    }
+    for (size_t v = 0; v < nv; v++)
+    {
+        _out_off[v + 1] += _out_off[v];
+        _in_off[v + 1] += _in_off[v];
+    }
+
+    _out.resize(edges.size());
+    _in.resize(edges.size());
+    std::vector<size_t> opos(_out_off.begin(), _out_off.end() - 1);
+    std::vector<size_t> ipos(_in_off.begin(), _in_off.end() - 1);
+    for (const auto& e : edges)
+    {
+        _out[opos[e.first]++] = e.second;
+        _in[ipos[e.second]++] = e.first;
+    }
+}
+
+/* ================================================================ */
+
+/// Level-synchronous BFS. The vertices on the current frontier are
+/// split across threads; a vertex is claimed for the next frontier
+/// by whichever thread first swaps its distance away from -1.
+std::vector<int32_t> GraphView::bfs(Vertex source, unsigned nthreads) const
+{
+    nthreads = thread_count(nthreads);
+    size_t nv = num_vertices();
+    std::vector<std::atomic<int32_t>> dist(nv);
+    for (auto& d : dist) d.store(-1, std::memory_order_relaxed);
+    if (nv <= source) return std::vector<int32_t>(nv, -1);
+
+    dist[source] = 0;
+    std::vector<Vertex> frontier({source});
+    std::vector<std::vector<Vertex>> next(nthreads);
+    int32_t level = 0;
+
+    while (not frontier.empty())
+    {
+        level++;
+        parallel_for(frontier.size(), nthreads,
+            [&](size_t tid, size_t b, size_t e)
+        {
+            std::vector<Vertex>& mine = next[tid];
+            for (size_t i = b; i < e; i++)
+            {
+                for (Vertex u : out_neighbors(frontier[i]))
+                {
+                    int32_t unseen = -1;
+                    if (dist[u].load(std::memory_order_relaxed) == -1 and
+                        dist[u].compare_exchange_strong(unseen, level,
+                                             std::memory_order_relaxed))
+                        mine.push_back(u);
+                }
+            }
+        }, MIN_CHUNK);
+
+        frontier.clear();
+        for (auto& mine : next)
+        {
+            frontier.insert(frontier.end(), mine.begin(), mine.end());
+            mine.clear();
+        }
+    }
+
+    std::vector<int32_t> result(nv);
+    for (size_t v = 0; v < nv; v++)
+        result[v] = dist[v].load(std::memory_order_relaxed);
+    return result;
+}
+
+/* ================================================================ */
+
+/// Lock-free union-find. A root is always linked under a smaller root,
+/// so every vertex points at a vertex no larger than itself, and the
+/// final root of each component is its smallest vertex. The finds do
+/// path halving as they go.
+std::vector<GraphView::Vertex> GraphView::components(unsigned nthreads) const
+{
+    nthreads = thread_count(nthreads);
+    size_t nv = num_vertices();
+    std::vector<std::atomic<Vertex>> parent(nv);
+    for (size_t v = 0; v < nv; v++)
+        parent[v].store(v, std::memory_order_relaxed);
+
+    auto find = [&](Vertex x)
+    {
+        while (true)
+        {
+            Vertex p = parent[x].load(std::memory_order_relaxed);
+            if (p == x) return x;
+            Vertex gp = parent[p].load(std::memory_order_relaxed);
+            if (gp != p)
+                parent[x].compare_exchange_weak(p, gp,
+                                                std::memory_order_relaxed);
+            x = gp;
+        }
+    };
+
+    parallel_for(nv, nthreads, [&](size_t, size_t b, size_t e)
+    {
+        for (Vertex v = b; v < e; v++)
+        {
+            for (Vertex u : out_neighbors(v))
+            {
+                Vertex a = v;
+                while (true)
+                {
+                    a = find(a);
+                    u = find(u);
+                    if (a == u) break;
+                    if (a < u) std::swap(a, u);
+                    Vertex expect = a;
+                    if (parent[a].compare_exchange_strong(expect, u,
+                                               std::memory_order_relaxed))
+                        break;
+                }
+            }
+        }
+    }, MIN_CHUNK);
+
+    std::vector<Vertex> label(nv);
+    parallel_for(nv, nthreads, [&](size_t, size_t b, size_t e)
+    {
+        for (Vertex v = b; v < e; v++) label[v] = find(v);
+    }, MIN_CHUNK);
+    return label;
+}
+
+/* ================================================================ */
+
+/// Pull-style power iteration: each vertex sums the contributions of
+/// its in-neighbors, so that no two threads write the same entry.
+/// Vertices with no out-edges spread their rank evenly over all.
+std::vector<double> GraphView::pagerank(double damping, double tolerance,
+                                        size_t max_iterations,
+                                        unsigned nthreads) const
+{
+    nthreads = thread_count(nthreads);
+    size_t nv = num_vertices();
+    if (0 == nv) return std::vector<double>();
+
+    std::vector<double> rank(nv, 1.0 / nv);
+    std::vector<double> next(nv);
+    std::vector<double> contrib(nv);
+    std::vector<double> partial(nthreads);
+
+    for (size_t iter = 0; iter < max_iterations; iter++)
+    {
+        // Contribution per out-edge, and the rank of dangling vertices.
+        std::fill(partial.begin(), partial.end(), 0.0);
+        parallel_for(nv, nthreads, [&](size_t tid, size_t b, size_t e)
+        {
+            double dangling = 0.0;
+            for (size_t v = b; v < e; v++)
+            {
+                size_t deg = out_degree(v);
+                if (0 == deg) { dangling += rank[v]; contrib[v] = 0.0; }
+                else contrib[v] = rank[v] / deg;
+            }
+            partial[tid] = dangling;
+        }, MIN_CHUNK);
+        double dangling = 0.0;
+        for (double d : partial) dangling += d;
+
+        double base = (1.0 - damping + damping * dangling) / nv;
+
+        std::fill(partial.begin(), partial.end(), 0.0);
+        parallel_for(nv, nthreads, [&](size_t tid, size_t b, size_t e)
+        {
+            double delta = 0.0;
+            for (size_t v = b; v < e; v++)
+            {
+                double sum = 0.0;
+                for (Vertex u : in_neighbors(v)) sum += contrib[u];
+                next[v] = base + damping * sum;
+                delta += std::fabs(next[v] - rank[v]);
+            }
+            partial[tid] = delta;
+        }, MIN_CHUNK);
+        double delta = 0.0;
+        for (double d : partial) delta += d;
+
+        rank.swap(next);
+        if (delta < tolerance) break;
+    }
+    return rank;
+}
+
+/* ================================================================ */
+
+void GraphView::set_values(const Handle& key,
+                           const std::vector<double>& vals) const
+{
+    size_t n = std::min(vals.size(), _atoms.size());
+    for (size_t v = 0; v < n; v++)
+        _as->set_value(_atoms[v], key, createFloatValue(vals[v]));
+}
+
+void GraphView::set_values(const Handle& key,
+                           const std::vector<int32_t>& vals) const
+{
+    set_values(key, std::vector<double>(vals.begin(), vals.end()));
+}
+
+void GraphView::set_values(const Handle& key,
+                           const std::vector<Vertex>& vals) const
+{
+    set_values(key, std::vector<double>(vals.begin(), vals.end()));
+}
+
+} // namespace opencog
@@ -0,0 +1,150 @@
+/*
+ * GraphView.h
+ *
+ * Copyright (C) 2026 OpenCog Foundation
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License v3 as
+ * published by the Free Software Foundation and including the exceptions
+ * at http://opencog.org/wiki/Licenses
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program; if not, write to:
+ * Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#ifndef _OPENCOG_GRAPH_VIEW_H
+#define _OPENCOG_GRAPH_VIEW_H
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <opencog/atoms/base/Handle.h>
+#include <opencog/atoms/atom_types/types.h>
+
+namespace opencog
+{
+/** \addtogroup grp_atomspace
+ *  @{
+ */
+
+class AtomSpace;
+
+/**
+ * A frozen, read-only snapshot of a subgraph of the AtomSpace, stored
+ * in compressed-sparse-row (CSR) form, for running whole-graph
+ * algorithms.
+ *
+ * The functions in Neighbors.h walk the incoming set of an Atom on
+ * every call: that is a copy of a set of weak pointers, followed by a
+ * type check on each Link. This is fine for local exploration, but
+ * graph algorithms touch every edge many times over. The GraphView
+ * does that walk once. Each Atom in the subgraph gets a dense vertex
+ * number, and the edges out of (and into) each vertex are stored as
+ * contiguous arrays of vertex numbers. After that, traversal is a
+ * matter of scanning arrays of integers.
+ *
+ * The edges are the Links of a given type. An ordered Link is an edge
+ * from its first Atom to each of the others; this is the same
+ * convention as get_target_neighbors(). An unordered Link is an edge
+ * in both directions between every pair of its Atoms. If `directed`
+ * is false, every edge is also added in reverse.
+ *
+ * The view is a snapshot: changes to the AtomSpace made after it was
+ * built are not seen.
+ */
+class GraphView
+{
+public:
+    typedef uint32_t Vertex;
+    static const Vertex NO_VERTEX = UINT32_MAX;
+
+    /// A contiguous run of neighboring vertices.
+    struct Range
+    {
+        const Vertex* first;
+        const Vertex* last;
+        const Vertex* begin() const { return first; }
+        const Vertex* end() const { return last; }
+        size_t size() const { return last - first; }
+    };
+
+private:
+    AtomSpace* _as;
+    HandleSeq _atoms;
+    std::unordered_map<Handle, Vertex> _index;
+
+    // Out-edges of vertex v are _out[_out_off[v] .. _out_off[v+1]],
+    // and likewise for the in-edges.
+    std::vector<size_t> _out_off;
+    std::vector<Vertex> _out;
+    std::vector<size_t> _in_off;
+    std::vector<Vertex> _in;
+
+    Vertex add_vertex(const Handle&);
+    void build(const HandleSeq&, bool);
+
+public:
+    /// Freeze all Links of type `link_type` (and, optionally, of its
+    /// subtypes) in the AtomSpace.
+    GraphView(AtomSpace*, Type link_type, bool subtypes = false,
+              bool directed = true);
+
+    /// Freeze the given Links. Results written with set_values()
+    /// go to the given AtomSpace.
+    GraphView(AtomSpace*, const HandleSeq& links, bool directed = true);
+
+    size_t num_vertices() const { return _atoms.size(); }
+    size_t num_edges() const { return _out.size(); }
+
+    /// The Atom for vertex `v`, and the vertex for an Atom.
+    const Handle& atom(Vertex v) const { return _atoms[v]; }
+    const HandleSeq& atoms() const { return _atoms; }
+    Vertex vertex(const Handle&) const;
+
+    Range out_neighbors(Vertex v) const
+        { return {_out.data() + _out_off[v], _out.data() + _out_off[v+1]}; }
+    Range in_neighbors(Vertex v) const
+        { return {_in.data() + _in_off[v], _in.data() + _in_off[v+1]}; }
+    size_t out_degree(Vertex v) const
+        { return _out_off[v+1] - _out_off[v]; }
+    size_t in_degree(Vertex v) const
+        { return _in_off[v+1] - _in_off[v]; }
+
+    // The algorithms below run on `nthreads` threads; zero means one
+    // per CPU core.
+
+    /// Breadth-first search from `source`, following out-edges.
+    /// Returns the distance, in hops, to each vertex; -1 if it is
+    /// not reachable.
+    std::vector<int32_t> bfs(Vertex source, unsigned nthreads = 0) const;
+
+    /// Weakly connected components. Returns, for each vertex, the
+    /// smallest vertex number in its component.
+    std::vector<Vertex> components(unsigned nthreads = 0) const;
+
+    /// PageRank, by power iteration, stopping when the L1 change
+    /// falls below `tolerance`. The ranks sum to one.
+    std::vector<double> pagerank(double damping = 0.85,
+                                 double tolerance = 1.0e-9,
+                                 size_t max_iterations = 100,
+                                 unsigned nthreads = 0) const;
+
+    /// Write one number per vertex back to the AtomSpace, as a
+    /// FloatValue at `key` on each Atom.
+    void set_values(const Handle& key, const std::vector<double>&) const;
+    void set_values(const Handle& key, const std::vector<int32_t>&) const;
+    void set_values(const Handle& key, const std::vector<Vertex>&) const;
+};
+
+/** @}*/
+}
+
+#endif // _OPENCOG_GRAPH_VIEW_H
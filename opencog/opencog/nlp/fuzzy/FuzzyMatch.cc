@@ -26,6 +26,7 @@
 #include <opencog/atoms/core/FindUtils.h>
 
 #include "FuzzyMatch.h"
+#include "MinHashIndex.h"
 
 using namespace opencog;
 
@@ -75,12 +76,21 @@ void FuzzyMatch::find_starters(const Handle& hp)
 }
 
 /**
- * Find leaves at which a search can be started.
+ * Find leaves at which a search can be started, or, if there is an
+ * index, ask it for the candidates.
  */
 RankedHandleSeq FuzzyMatch::perform_search(const Handle& target)
 {
 	start_search(target);
 
+	// Propose the candidates from the index, if there is one.
+	if (_index)
+	{
+		for (const auto& cand : _index->top_k(target, _max_candidates))
+			try_match(cand.first);
+		return finished_search();
+	}
+
 	// Find starting atoms from which to begin matches.
 	find_starters(target);
 
@@ -70,16 +70,34 @@ namespace opencog
  * true, then larger and larger trees holding the starter are proposed.
  * If it returns false, then the proposal of the ever-larger trees
  * halts.
+ *
+ * On a large AtomSpace, the exhaustive search is slow, as common
+ * nodes have huge incoming sets. If a MinHashIndex is given with
+ * `set_index()`, then only the trees that the index finds to be most
+ * similar to the target are proposed to `try_match()`, and the
+ * incoming sets are not explored. Trees that are not much alike may
+ * then be missed; see MinHashIndex.
  */
 
 typedef std::vector<std::pair<Handle, double>> RankedHandleSeq;
 
+class MinHashIndex;
+
 class FuzzyMatch
 {
 public:
     RankedHandleSeq perform_search(const Handle&);
     virtual ~FuzzyMatch() {}
 
+    /// Propose the `max_candidates` trees that the index finds to be
+    /// most similar, instead of exploring. A null index restores the
+    /// exhaustive search.
+    void set_index(MinHashIndex* idx, size_t max_candidates = 100)
+    {
+        _index = idx;
+        _max_candidates = max_candidates;
+    }
+
 protected:
     virtual void start_search(const Handle&) = 0;
     virtual bool accept_starter(const Handle&) = 0;
@@ -87,6 +105,9 @@ protected:
     virtual RankedHandleSeq finished_search(void) = 0;
 
 private:
+    MinHashIndex* _index = nullptr;
+    size_t _max_candidates = 0;
+
     void find_starters(const Handle&);
     void explore(const Handle&);
 };
@@ -22,10 +22,16 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
  */
 
+#include <map>
+#include <mutex>
+
 #include <opencog/atoms/base/Handle.h>
+#include <opencog/atomspace/AtomSpace.h>
 
 namespace opencog
 {
+class MinHashIndex;
+
 namespace nlp
 {
 
@@ -37,9 +43,20 @@ class FuzzySCM
         void init(void);
 
         Handle find_approximate_match(Handle);
+        bool set_fuzzy_index(int, int);
         Handle do_nlp_fuzzy_match(Handle, Type, const HandleSeq&,bool);
         Handle do_nlp_fuzzy_compare(Handle, Handle);
 
+        // The indexes used by cog-fuzzy-match, one per AtomSpace. Each
+        // holds on to its AtomSpace, so that the index goes first.
+        struct Indexed
+        {
+            AtomSpacePtr as;
+            std::shared_ptr<MinHashIndex> index;
+        };
+        std::mutex _index_mtx;
+        std::map<const AtomSpace*, Indexed> _indexes;
+
     public:
         FuzzySCM();
 };
@@ -57,6 +74,7 @@ void opencog_nlp_fuzzy_init(void);
 
 #include "Fuzzy.h"
 #include "FuzzyMatchBasic.h"
+#include "MinHashIndex.h"
 
 using namespace opencog::nlp;
 using namespace opencog;
@@ -104,6 +122,8 @@ void FuzzySCM::init()
 {
     define_scheme_primitive("cog-fuzzy-match",
         &FuzzySCM::find_approximate_match, this, "nlp fuzzy");
+    define_scheme_primitive("cog-fuzzy-index",
+        &FuzzySCM::set_fuzzy_index, this, "nlp fuzzy");
     define_scheme_primitive("nlp-fuzzy-match", &FuzzySCM::do_nlp_fuzzy_match,
                             this, "nlp fuzzy");
 
@@ -111,16 +131,64 @@ void FuzzySCM::init()
                             this, "nlp fuzzy");
 }
 
+/**
+ * Implement the "cog-fuzzy-match" scheme primitive. If the current
+ * AtomSpace has an index (see "cog-fuzzy-index"), the candidates are
+ * taken from it; else, the search is exhaustive.
+ */
 Handle FuzzySCM::find_approximate_match(Handle hp)
 {
-	FuzzyMatchBasic fpm;
-	RankedHandleSeq ranked_solns = fpm.perform_search(hp);
-	HandleSeq solns;
-	for (auto rs: ranked_solns)
-		solns.emplace_back(rs.first);
-
-	AtomSpacePtr asp = SchemeSmob::ss_get_env_as("cog-fuzzy-match");
-	return asp->add_link(LIST_LINK, std::move(solns));
+    AtomSpacePtr asp = SchemeSmob::ss_get_env_as("cog-fuzzy-match");
+
+    std::shared_ptr<MinHashIndex> idx;
+    {
+        std::lock_guard<std::mutex> lck(_index_mtx);
+        auto it = _indexes.find(asp.get());
+        if (it != _indexes.end()) idx = it->second.index;
+    }
+
+    FuzzyMatchBasic fpm;
+    fpm.set_index(idx.get());
+    RankedHandleSeq ranked_solns = fpm.perform_search(hp);
+    HandleSeq solns;
+    for (auto rs: ranked_solns)
+        solns.emplace_back(rs.first);
+
+    return asp->add_link(LIST_LINK, std::move(solns));
+}
+
+/**
+ * Implement the "cog-fuzzy-index" scheme primitive. It builds a
+ * MinHashIndex of all Links in the current AtomSpace, to be used by
+ * "cog-fuzzy-match" from then on. The index is kept up to date as
+ * Atoms are added and removed.
+ *
+ * @param bands, rows  See MinHashIndex. More bands, or fewer rows,
+ *                     find less similar trees, but are slower.
+ *                     Zero bands drops the index, and
+ *                     "cog-fuzzy-match" is exhaustive again.
+ * @return             True if there is now an index.
+ */
+bool FuzzySCM::set_fuzzy_index(int bands, int rows)
+{
+    AtomSpacePtr asp = SchemeSmob::ss_get_env_as("cog-fuzzy-index");
+
+    std::shared_ptr<MinHashIndex> idx;
+    if (0 < bands)
+        idx = std::make_shared<MinHashIndex>(asp.get(), LINK, true,
+                                             bands, std::max(1, rows));
+
+    // The old index, if any, is dropped after unlocking.
+    Indexed old;
+    std::lock_guard<std::mutex> lck(_index_mtx);
+    auto it = _indexes.find(asp.get());
+    if (it != _indexes.end())
+    {
+        old = std::move(it->second);
+        _indexes.erase(it);
+    }
+    if (idx) _indexes[asp.get()] = {asp, idx};
+    return nullptr != idx;
 }
 
 /**
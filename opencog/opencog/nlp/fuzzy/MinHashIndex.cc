@@ -0,0 +1,265 @@
+/*
+ * MinHashIndex.cc
+ *
+ * Copyright (C) 2026 OpenCog Foundation
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License v3 as
+ * published by the Free Software Foundation and including the exceptions
+ * at http://opencog.org/wiki/Licenses
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program; if not, write to:
+ * Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <algorithm>
+
+#include <opencog/atoms/core/FindUtils.h>
+
+#include "MinHashIndex.h"
+
+using namespace opencog;
+
+/// The finalizer of splitmix64; a cheap, well-mixed 64-bit hash.
+static inline uint64_t mix(uint64_t x)
+{
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+MinHashIndex::MinHashIndex(AtomSpace* as, Type type, bool subtypes,
+                           size_t bands, size_t rows)
+    : _as(as), _type(type), _subtypes(subtypes),
+      _bands(std::max<size_t>(1, bands)), _rows(std::max<size_t>(1, rows)),
+      _dropped(0)
+{
+    // The hash functions differ only by their seed. The seeds are
+    // fixed, so that signatures are the same from one run to the next.
+    uint64_t seed = 0x9e3779b97f4a7c15ULL;
+    for (size_t i = 0; i < _bands * _rows; i++)
+    {
+        seed += 0x9e3779b97f4a7c15ULL;
+        _seeds.push_back(mix(seed));
+    }
+
+    // Subscribe before scanning, so that nothing added in between
+    // is missed; insert() skips trees that are already indexed.
+    _feed = _as->subscribe_changes();
+    rebuild();
+}
+
+MinHashIndex::~MinHashIndex()
+{
+    _as->unsubscribe_changes(_feed);
+}
+
+/* ================================================================ */
+
+HandleSeq MinHashIndex::get_nodes(const Handle& h)
+{
+    HandleSeq nodes;
+    HandleSeq todo({h});
+    while (not todo.empty())
+    {
+        Handle a(todo.back());
+        todo.pop_back();
+        if (a->is_node())
+            nodes.emplace_back(a);
+        else
+            for (const Handle& o : a->getOutgoingSet())
+                todo.emplace_back(o);
+    }
+    std::sort(nodes.begin(), nodes.end());
+    nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+    return nodes;
+}
+
+bool MinHashIndex::wanted(const Handle& h) const
+{
+    if (not h->is_link()) return false;
+    Type t = h->get_type();
+    return t == _type or (_subtypes and nameserver().isA(t, _type));
+}
+
+MinHashIndex::Signature MinHashIndex::signature(const HandleSeq& nodes) const
+{
+    Signature sig(_seeds.size(), UINT32_MAX);
+    for (const Handle& n : nodes)
+    {
+        uint64_t nh = n->get_hash();
+        for (size_t i = 0; i < _seeds.size(); i++)
+        {
+            uint32_t v = mix(nh ^ _seeds[i]) >> 32;
+            if (v < sig[i]) sig[i] = v;
+        }
+    }
+    return sig;
+}
+
+uint64_t MinHashIndex::band_key(const Signature& sig, size_t band) const
+{
+    uint64_t key = band;
+    for (size_t r = band * _rows; r < (band + 1) * _rows; r++)
+        key = mix(key ^ sig[r]);
+    return key;
+}
+
+/* ================================================================ */
+
+void MinHashIndex::insert(const Handle& h)
+{
+    if (_sigs.find(h) != _sigs.end()) return;
+
+    HandleSeq nodes(get_nodes(h));
+    if (nodes.empty()) return;
+
+    Signature sig(signature(nodes));
+    for (size_t b = 0; b < _bands; b++)
+        _buckets[b][band_key(sig, b)].insert(h);
+    _sigs.emplace(h, std::move(sig));
+}
+
+void MinHashIndex::remove(const Handle& h)
+{
+    auto it = _sigs.find(h);
+    if (it == _sigs.end()) return;
+
+    for (size_t b = 0; b < _bands; b++)
+    {
+        auto bucket = _buckets[b].find(band_key(it->second, b));
+        if (bucket == _buckets[b].end()) continue;
+        bucket->second.erase(h);
+        if (bucket->second.empty()) _buckets[b].erase(bucket);
+    }
+    _sigs.erase(it);
+}
+
+void MinHashIndex::scan(void)
+{
+    _sigs.clear();
+    _buckets.assign(_bands, {});
+
+    HandleSeq links;
+    _as->get_handles_by_type(links, _type, _subtypes);
+    for (const Handle& h : links)
+        insert(h);
+}
+
+/// Apply the queued change events. If any were dropped, the index
+/// can no longer be trusted, and is rebuilt.
+void MinHashIndex::drain(void)
+{
+    std::vector<AtomEvent> batch;
+    _feed->drain(batch);
+
+    size_t dropped = _feed->dropped();
+    if (dropped != _dropped)
+    {
+        _dropped = dropped;
+        scan();
+        return;
+    }
+
+    for (const AtomEvent& ev : batch)
+    {
+        if (not wanted(ev.atom)) continue;
+        if (AtomEvent::ADDED == ev.kind) insert(ev.atom);
+        else if (AtomEvent::EXTRACTED == ev.kind) remove(ev.atom);
+    }
+}
+
+void MinHashIndex::update(void)
+{
+    std::lock_guard<std::mutex> lck(_mtx);
+    drain();
+}
+
+void MinHashIndex::rebuild(void)
+{
+    std::lock_guard<std::mutex> lck(_mtx);
+
+    // Anything already queued is covered by the scan.
+    std::vector<AtomEvent> stale;
+    _feed->drain(stale);
+    _dropped = _feed->dropped();
+    scan();
+}
+
+size_t MinHashIndex::size(void)
+{
+    std::lock_guard<std::mutex> lck(_mtx);
+    drain();
+    return _sigs.size();
+}
+
+/* ================================================================ */
+
+RankedHandleSeq MinHashIndex::top_k(const Handle& target, size_t k)
+{
+    HandleSeq target_nodes(get_nodes(target));
+    if (target_nodes.empty() or 0 == k) return RankedHandleSeq();
+    Signature sig(signature(target_nodes));
+
+    UnorderedHandleSet candidates;
+    {
+        std::lock_guard<std::mutex> lck(_mtx);
+        drain();
+        for (size_t b = 0; b < _bands; b++)
+        {
+            auto bucket = _buckets[b].find(band_key(sig, b));
+            if (bucket == _buckets[b].end()) continue;
+            candidates.insert(bucket->second.begin(), bucket->second.end());
+        }
+    }
+
+    // Rank the candidates by exact similarity; among equals, prefer
+    // the ones closest in size to the target, as FuzzyMatchBasic does.
+    struct Ranked { Handle h; double sim; size_t diff; };
+    std::vector<Ranked> ranked;
+    for (const Handle& h : candidates)
+    {
+        if (is_atom_in_tree(target, h)) continue;
+
+        HandleSeq nodes(get_nodes(h));
+        HandleSeq common;
+        std::set_intersection(target_nodes.begin(), target_nodes.end(),
+                              nodes.begin(), nodes.end(),
+                              std::back_inserter(common));
+        size_t nunion = target_nodes.size() + nodes.size() - common.size();
+        double sim = ((double) common.size()) / nunion;
+        size_t diff = std::max(nodes.size(), target_nodes.size())
+                    - std::min(nodes.size(), target_nodes.size());
+        ranked.push_back({h, sim, diff});
+    }
+
+    auto better = [](const Ranked& a, const Ranked& b)
+    {
+        if (a.sim != b.sim) return a.sim > b.sim;
+        if (a.diff != b.diff) return a.diff < b.diff;
+        return a.h < b.h;
+    };
+    if (k < ranked.size())
+    {
+        std::partial_sort(ranked.begin(), ranked.begin() + k, ranked.end(),
+                          better);
+        ranked.resize(k);
+    }
+    else
+        std::sort(ranked.begin(), ranked.end(), better);
+
+    RankedHandleSeq result;
+    for (const Ranked& r : ranked)
+        result.push_back({r.h, r.sim});
+    return result;
+}
@@ -0,0 +1,122 @@
+/*
+ * MinHashIndex.h
+ *
+ * Copyright (C) 2026 OpenCog Foundation
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License v3 as
+ * published by the Free Software Foundation and including the exceptions
+ * at http://opencog.org/wiki/Licenses
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program; if not, write to:
+ * Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#ifndef MINHASH_INDEX_H
+#define MINHASH_INDEX_H
+
+#include <mutex>
+#include <unordered_map>
+
+#include <opencog/atomspace/AtomSpace.h>
+#include <opencog/nlp/fuzzy/FuzzyMatch.h>
+
+namespace opencog
+{
+/**
+ * A locality-sensitive index of trees, for finding the trees that
+ * share the most nodes with a given target.
+ *
+ * FuzzyMatchBasic finds similar trees by walking up the incoming sets
+ * of the target's nodes, flattening every tree that it meets and
+ * intersecting its node set with the target's. On a large AtomSpace,
+ * a common node (a predicate, say) has a huge incoming set, and so
+ * nearly every tree gets flattened, on every search.
+ *
+ * This index does the flattening once, when a tree is added. The set
+ * of nodes in each tree is reduced to a MinHash signature: for each
+ * of `bands * rows` hash functions, the smallest hash of any node in
+ * the set. Two sets agree on any one of these minima with probability
+ * equal to their Jaccard similarity. The signature is cut into
+ * `bands` bands of `rows` minima each, and each band is hashed into a
+ * bucket. A search looks only at the trees that share a bucket with
+ * the target in at least one band; these are then ranked by their
+ * exact Jaccard similarity. Trees with similarity s become candidates
+ * with probability 1 - (1 - s^rows)^bands; more bands find less
+ * similar trees, at the cost of more candidates.
+ *
+ * The index subscribes to the AtomSpace change feed, and picks up
+ * Links that have been added or extracted since the last search.
+ * Should the feed overflow, the index is rebuilt from scratch. Note
+ * that clearing the AtomSpace is not reported by the feed; call
+ * rebuild() after doing that.
+ */
+class MinHashIndex
+{
+public:
+    /// Index every Link of type `type` (and of its subtypes, if
+    /// `subtypes` is set) in the AtomSpace, now and as they are added.
+    MinHashIndex(AtomSpace*, Type type = LINK, bool subtypes = true,
+                 size_t bands = 16, size_t rows = 4);
+    ~MinHashIndex();
+
+    MinHashIndex(const MinHashIndex&) = delete;
+    MinHashIndex& operator=(const MinHashIndex&) = delete;
+
+    /// Return up to `k` indexed trees most similar to `target`, most
+    /// similar first, each paired with the Jaccard similarity of its
+    /// node set to that of the target. The target itself, and trees
+    /// that occur inside of it, are never returned.
+    RankedHandleSeq top_k(const Handle& target, size_t k);
+
+    /// Apply the pending changes from the AtomSpace. This is done
+    /// automatically by top_k().
+    void update(void);
+
+    /// Drop everything, and index the AtomSpace afresh.
+    void rebuild(void);
+
+    /// Number of trees in the index.
+    size_t size(void);
+
+    /// The sorted, de-duplicated set of nodes in the tree.
+    static HandleSeq get_nodes(const Handle&);
+
+private:
+    typedef std::vector<uint32_t> Signature;
+
+    AtomSpace* _as;
+    Type _type;
+    bool _subtypes;
+    size_t _bands;
+    size_t _rows;
+    std::vector<uint64_t> _seeds;
+
+    ChangeSubscriberPtr _feed;
+    size_t _dropped;
+
+    std::mutex _mtx;
+    std::unordered_map<Handle, Signature> _sigs;
+
+    // One hash table per band, from the hash of the band to the trees
+    // having that band.
+    std::vector<std::unordered_map<uint64_t, UnorderedHandleSet>> _buckets;
+
+    bool wanted(const Handle&) const;
+    Signature signature(const HandleSeq&) const;
+    uint64_t band_key(const Signature&, size_t) const;
+    void insert(const Handle&);
+    void remove(const Handle&);
+    void scan(void);
+    void drain(void);
+};
+
+} // namespace opencog
+#endif  // MINHASH_INDEX_H
@@ -0,0 +1,175 @@
+/*
+ * OpenPsiContextIndex.cc
+ *
+ * Copyright (C) 2026 OpenCog Foundation
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License v3 as
+ * published by the Free Software Foundation and including the exceptions
+ * at http://opencog.org/wiki/Licenses
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program; if not, write to:
+ * Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <opencog/atoms/atom_types/NameServer.h>
+#include <opencog/atoms/base/Link.h>
+#include <opencog/atoms/core/FindUtils.h>
+
+#include "OpenPsiContextIndex.h"
+
+using namespace opencog;
+
+OpenPsiContextIndex::OpenPsiContextIndex(AtomSpace* as) :
+  _as(as), _as_ref(as->weak_from_this()), _dropped(0)
+{
+  _shared = not _as_ref.expired();
+  _feed = _as->subscribe_changes();
+}
+
+OpenPsiContextIndex::~OpenPsiContextIndex()
+{
+  // The implicator is usually a static instance, which may well
+  // outlive a shared atomspace; only unsubscribe if it is still there.
+  // An atomspace that isn't shared is the owner's to keep alive.
+  if (not _shared)
+    _as->unsubscribe_changes(_feed);
+  else if (ValuePtr keep = _as_ref.lock())
+    _as->unsubscribe_changes(_feed);
+}
+
+/**
+ * Can `atom` be a grounding of `term`? This errs on the side of yes:
+ * variables match anything, whatever their type restrictions, and
+ * unordered links and globs are only checked by type.
+ */
+static bool could_match(const Handle& term, const Handle& atom,
+                        const HandleSet& vars)
+{
+  if (vars.find(term) != vars.end()) return true;
+  if (term->get_type() != atom->get_type()) return false;
+  if (term->is_node()) return content_eq(term, atom);
+
+  if (nameserver().isA(term->get_type(), UNORDERED_LINK)) return true;
+
+  const HandleSeq& tout = term->getOutgoingSet();
+  const HandleSeq& aout = atom->getOutgoingSet();
+  for (const Handle& t : tout)
+    if (t->get_type() == GLOB_NODE) return true;
+
+  if (tout.size() != aout.size()) return false;
+  for (size_t i = 0; i < tout.size(); i++)
+    if (not could_match(tout[i], aout[i], vars)) return false;
+  return true;
+}
+
+/**
+ * Add the templates for one clause. The logical connectives are not
+ * matched themselves; their arguments are. Returns false if the clause
+ * cannot be indexed.
+ */
+bool OpenPsiContextIndex::add_templates(const Handle& body, const Handle& term,
+                                        const HandleSet& vars)
+{
+  Type t = term->get_type();
+  if (t == AND_LINK or t == OR_LINK or t == NOT_LINK or
+      t == CHOICE_LINK or nameserver().isA(t, PRESENT_LINK))
+  {
+    for (const Handle& h : term->getOutgoingSet())
+      if (not add_templates(body, h, vars)) return false;
+    return true;
+  }
+
+  // A bare variable could be anything at all.
+  if (vars.find(term) != vars.end()) return false;
+
+  _alpha.emplace(t, Template{body, term, &vars});
+  return true;
+}
+
+void OpenPsiContextIndex::add_query(const PatternLinkPtr& query)
+{
+  const Pattern& pat = query->get_pattern();
+  const Handle& body = pat.body;
+
+  std::lock_guard<std::mutex> lck(_mtx);
+  if (_tracked.find(body) != _tracked.end()) return;
+
+  auto ins = _tracked.emplace(body, query->get_variables().varset);
+  const HandleSet& vars = ins.first->second;
+
+  bool indexable = not pat.have_evaluatables and
+    not contains_atomtype(body, QUOTE_LINK) and
+    not contains_atomtype(body, LOCAL_QUOTE_LINK);
+
+  // Walk the body, rather than the clauses that the pattern engine
+  // kept; constant clauses are then indexed too, which is harmless.
+  size_t before = _alpha.size();
+  if (indexable)
+    indexable = add_templates(body, body, vars);
+  size_t ntemplates = _alpha.size() - before;
+
+  if (not indexable or 0 == ntemplates)
+  {
+    for (auto it = _alpha.begin(); it != _alpha.end(); )
+      if (it->second.body == body) it = _alpha.erase(it);
+      else it++;
+    _volatile.insert(body);
+  }
+}
+
+/** Mark stale every context having a template that `atom` fits. */
+void OpenPsiContextIndex::touch(const Handle& atom)
+{
+  auto range = _alpha.equal_range(atom->get_type());
+  for (auto it = range.first; it != range.second; it++)
+  {
+    const Template& tp = it->second;
+    if (_current.find(tp.body) == _current.end()) continue;
+    if (could_match(tp.term, atom, *tp.vars))
+      _current.erase(tp.body);
+  }
+}
+
+void OpenPsiContextIndex::update()
+{
+  std::vector<AtomEvent> batch;
+  std::lock_guard<std::mutex> lck(_mtx);
+  _feed->drain(batch);
+
+  size_t dropped = _feed->dropped();
+  if (dropped != _dropped)
+  {
+    _dropped = dropped;
+    _current.clear();
+    return;
+  }
+
+  for (const AtomEvent& ev : batch)
+  {
+    if (_current.empty()) break;
+    if (AtomEvent::VALUE_SET == ev.kind) continue;
+    touch(ev.atom);
+  }
+}
+
+bool OpenPsiContextIndex::is_current(const Handle& body)
+{
+  std::lock_guard<std::mutex> lck(_mtx);
+  return _current.find(body) != _current.end();
+}
+
+void OpenPsiContextIndex::set_current(const Handle& body)
+{
+  std::lock_guard<std::mutex> lck(_mtx);
+  if (_tracked.find(body) == _tracked.end()) return;
+  if (_volatile.find(body) != _volatile.end()) return;
+  _current.insert(body);
+}
@@ -0,0 +1,130 @@
+/*
+ * OpenPsiContextIndex.h
+ *
+ * Copyright (C) 2026 OpenCog Foundation
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License v3 as
+ * published by the Free Software Foundation and including the exceptions
+ * at http://opencog.org/wiki/Licenses
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program; if not, write to:
+ * Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#ifndef _OPENCOG_OPENPSI_CONTEXT_INDEX_H
+#define _OPENCOG_OPENPSI_CONTEXT_INDEX_H
+
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <opencog/atoms/pattern/PatternLink.h>
+#include <opencog/atomspace/AtomSpace.h>
+
+namespace opencog
+{
+
+/**
+ * Keeps track of which rule contexts might have changed their
+ * satisfiability, so that only those need to be searched again.
+ *
+ * This is the alpha network of a Rete matcher. Every clause of every
+ * tracked context is a template; the templates are indexed by the
+ * type of atom they can match. Each atom added to, or extracted from
+ * the atomspace is run through the templates of its type; a context
+ * with a template that the atom fits has (possibly) gained or lost a
+ * grounding, and is marked stale. Contexts that none of the changes
+ * touch keep their last result. The cost of keeping up is thus
+ * proportional to the number of changes, and not to the number of
+ * rules times the size of the atomspace.
+ *
+ * The changes are taken from the atomspace change feed, and applied
+ * in a batch by update(). If the feed overflows, every context is
+ * marked stale.
+ *
+ * A context holding an evaluatable clause (a GroundedPredicate, a
+ * comparison of values, a nested Satisfaction, and the like) may
+ * depend on things outside of the atomspace. Such contexts are never
+ * considered current, and are searched afresh every time.
+ */
+class OpenPsiContextIndex
+{
+public:
+  OpenPsiContextIndex(AtomSpace* as);
+  ~OpenPsiContextIndex();
+
+  OpenPsiContextIndex(const OpenPsiContextIndex&) = delete;
+  OpenPsiContextIndex& operator=(const OpenPsiContextIndex&) = delete;
+
+  /**
+   * Start tracking the context of the given query. The context is
+   * stale until set_current() is called on it.
+   */
+  void add_query(const PatternLinkPtr& query);
+
+  /**
+   * Apply all the pending changes from the atomspace, marking the
+   * contexts they touch as stale.
+   */
+  void update();
+
+  /**
+   * @return true if the context with the given body is tracked, and
+   * nothing that might change its satisfiability has happened since
+   * set_current() was last called on it.
+   */
+  bool is_current(const Handle& body);
+
+  /**
+   * Record that the context with the given body has just been
+   * searched. Changes made after the last update() will still mark
+   * it stale, at the next update().
+   */
+  void set_current(const Handle& body);
+
+private:
+  AtomSpace* _as;
+  std::weak_ptr<Value> _as_ref;
+  bool _shared;
+
+  ChangeSubscriberPtr _feed;
+  size_t _dropped;
+
+  std::mutex _mtx;
+
+  struct Template
+  {
+    Handle body;
+    Handle term;
+    const HandleSet* vars;
+  };
+
+  // The alpha network: templates, by the type of atom they match.
+  std::unordered_multimap<Type, Template> _alpha;
+
+  // The tracked contexts, with their variables; the pointers in the
+  // templates point into here.
+  std::unordered_map<Handle, HandleSet> _tracked;
+
+  // Contexts that are always searched afresh.
+  std::unordered_set<Handle> _volatile;
+
+  // Contexts whose last result is still good.
+  std::unordered_set<Handle> _current;
+
+  bool add_templates(const Handle& body, const Handle& term,
+                     const HandleSet& vars);
+  void touch(const Handle& atom);
+};
+
+}; // namespace opencog
+
+#endif // _OPENCOG_OPENPSI_CONTEXT_INDEX_H
@@ -29,7 +29,8 @@
 
 using namespace opencog;
 
-OpenPsiImplicator::OpenPsiImplicator(AtomSpace* as)
+OpenPsiImplicator::OpenPsiImplicator(AtomSpace* as) :
+  _context_index(as)
 {
   _as = as;
   _action_executed = _as->add_node(PREDICATE_NODE, "action-executed");
@@ -38,20 +39,29 @@ OpenPsiImplicator::OpenPsiImplicator(AtomSpace* as)
 TruthValuePtr OpenPsiImplicator::check_satisfiability(const Handle& rule,
     OpenPsiRules& opr)
 {
-  // TODO:
-  // Solve for multithreaded access. Create a rule class and lock
-  // the rule when updating the cache.
-
   PatternLinkPtr query = opr.get_query(rule);
   Handle query_body = query->get_pattern().body;
 
-  // Always update cache to clear any previous result.
+  std::lock_guard<std::recursive_mutex> lck(_mtx);
+
+  // Search again only if the atomspace has changed in a way that might
+  // affect the result of the last search.
   // TODO: Add cache per atomspace.
+  _context_index.update();
+  if (_pattern_seen.find(query_body) == _pattern_seen.end()) {
+    _context_index.add_query(query);
+    _pattern_seen.insert(query_body);
+  } else if (_context_index.is_current(query_body)) {
+    if (_satisfiability_cache.find(query_body) != _satisfiability_cache.end())
+      return TruthValue::TRUE_TV();
+    return TruthValue::FALSE_TV();
+  }
+
   _satisfiability_cache.erase(query_body);
-  _pattern_seen.insert(query_body);
 
   OpenPsiSatisfier sater(_as, this);
   sater.satisfy(query);
+  _context_index.set_current(query_body);
 
   // The boolean returned by query->satisfy isn't used because all
   // type of contexts haven't been handled by this callback yet.
@@ -67,6 +77,7 @@ Handle OpenPsiImplicator::imply(const Handle& rule, OpenPsiRules& opr)
   PatternLinkPtr query = opr.get_query(rule);
   Handle query_body = query->get_pattern().body;
 
+  std::lock_guard<std::recursive_mutex> lck(_mtx);
   if (_pattern_seen.find(query_body) == _pattern_seen.end())
   {
     throw RuntimeException(TRACE_INFO, "The openpsi rule should be checked "
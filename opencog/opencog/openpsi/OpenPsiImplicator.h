@@ -23,8 +23,11 @@
 #ifndef _OPENCOG_OPENPSI_IMPLICATOR_H
 #define _OPENCOG_OPENPSI_IMPLICATOR_H
 
+#include <mutex>
+
 #include <opencog/atoms/pattern/PatternLink.h>
 #include <opencog/atomspace/AtomSpace.h>
+#include <opencog/openpsi/OpenPsiContextIndex.h>
 #include <opencog/openpsi/OpenPsiRules.h>
 #include <opencog/openpsi/OpenPsiSatisfier.h>
 
@@ -51,6 +54,10 @@ public:
    * Returns TRUE_TV if there is grounding else returns FALSE_TV. If the
    * cache has entry for the context then TRUE_TV is returned.
    *
+   * The context is only searched again if the atomspace has changed in
+   * a way that might affect it since it was last searched; see
+   * OpenPsiContextIndex.
+   *
    * @param rule An openpsi rule.
    */
   TruthValuePtr check_satisfiability(const Handle& rule, OpenPsiRules& opr);
@@ -85,6 +92,13 @@ private:
   // To store what pattern we've seen so far
   std::set<Handle> _pattern_seen;
 
+  // Tracks which of the patterns seen so far need to be searched again.
+  OpenPsiContextIndex _context_index;
+
+  // Guards the cache. It is recursive, because a grounded predicate in
+  // a context may well check the satisfiability of some other rule.
+  std::recursive_mutex _mtx;
+
   /**
    * An empty map used for clearing cache entries, or to denote absence
    * of groundings.